@@ -34,8 +34,8 @@ def run_cpp_simulation(file_name):
 
     exe_name = source_path.with_suffix('.exe' if platform.system() == "Windows" else '.out')
     
-    # Compilación (Optimizada -O3)
-    compile_cmd = ["g++", "-O3", str(source_path), "-o", str(exe_name)]
+    # Compilación (Optimizada -O3, C++17 e hilos para los motores paralelos de search_core.h)
+    compile_cmd = ["g++", "-O3", "-std=c++17", "-pthread", str(source_path), "-o", str(exe_name)]
     try:
         subprocess.run(compile_cmd, check=True, capture_output=True)
     except subprocess.CalledProcessError as e:
@@ -2,6 +2,11 @@
 #include <vector>
 #include <string>
 #include <cmath>
+#include <chrono>
+#include <cstdlib>
+
+#include "nqueens_completion.h"
+#include "nqueens_constructive.h"
 
 using namespace std;
 
@@ -39,7 +44,67 @@ bool solve(int row) {
     return false;
 }
 
+// Modo completación: N grande con reinas fijas. Por defecto la instancia difícil se busca barriendo k
+// (SEARCH_COMPLETION_K lo fija) y con SEARCH_COMPLETION_HARD iteraciones de ascenso; con
+// SEARCH_COMPLETION_HARD=0 es al azar y con SEARCH_COMPLETION_PLANTED=1 plantada (k por defecto 3N/4)
+void run_completion(int n) {
+    auto env = [](const char *name, long long fallback) {
+        const char *value = getenv(name);
+        return value != nullptr ? atoll(value) : fallback;
+    };
+    const int k = (int)env("SEARCH_COMPLETION_K", 0); // 0 = barrido (difícil) o 3N/4 (al azar, plantada)
+    const uint64_t seed = (uint64_t)env("SEARCH_COMPLETION_SEED", 1);
+    HardInstanceOptions hard;
+    hard.iterations = (int)env("SEARCH_COMPLETION_HARD", 200);
+    hard.k_min = hard.k_max = k;
+    hard.seed = seed;
+    const bool planted = env("SEARCH_COMPLETION_PLANTED", 0) != 0;
+    const bool search = !planted && hard.iterations > 0;
+
+    auto start = chrono::steady_clock::now();
+    HardInstanceReport report; // k elegido y fallos de la instancia frente a la línea base al azar
+    vector<QueenPlacement> fixed = search ? nqueens_completion_hard_instance(n, hard, &report)
+                                          : nqueens_completion_instance(n, k > 0 ? k : 3 * n / 4, seed, planted);
+    auto generated = chrono::steady_clock::now();
+
+    NQueensCompletion solver(n);
+    for (const QueenPlacement &q : fixed) solver.fix(q.row, q.col);
+    vector<int> columns;
+    CompletionOptions options;
+    options.seed = seed;
+    CompletionStats stats = solver.solve(options, columns);
+    auto end = chrono::steady_clock::now();
+
+    // Comprobar la completación: sin ataques y respetando las reinas fijas
+    bool valid = stats.result != COMPLETION_FOUND;
+    if (stats.result == COMPLETION_FOUND) {
+        NQueensVerifier verifier(n);
+        for (int row = 0; row < n; ++row) verifier(row, columns[row]);
+        valid = verifier.valid();
+        for (const QueenPlacement &q : fixed) valid = valid && columns[q.row] == q.col;
+    }
+
+    cout << "--- CSP Solver: Completar " << n << "-Queens (Mapas de bits + Propagación + Reinicios) ---" << endl;
+    string kind = planted ? "plantada" : "al azar";
+    if (search) kind = "buscada (k = " + to_string(report.k) + ", " + to_string(hard.iterations) + " iteraciones de ascenso)";
+    cout << "   * Instancia: " << fixed.size() << " reinas fijas, " << kind << ", generada en " << chrono::duration<double, milli>(generated - start).count() << " ms" << endl;
+    if (search) {
+        cout << "   * Dureza: " << report.effort << " fallos medios frente a " << report.baseline
+             << " de instancias al azar con el mismo k (" << report.evaluated << " instancias evaluadas)" << endl;
+    }
+    cout << "   * Resultado: " << completion_result_name(stats.result) << (valid ? "" : " (COMPLETACIÓN INVÁLIDA)") << endl;
+    cout << "   * Tiempo: " << chrono::duration<double, milli>(end - generated).count() << " ms" << endl;
+    cout << "   * Nodos: " << stats.nodes << ", fallos: " << stats.failures << ", reinicios: " << stats.restarts
+         << ", reinas propagadas: " << stats.propagated << endl;
+}
+
 int main() {
+    // Modo completación (SEARCH_COMPLETION_N=<N>): prueba de esfuerzo con reinas fijas para N grande
+    if (completion_mode_n() > 0) {
+        run_completion(completion_mode_n());
+        return 0;
+    }
+
     // Partial Assignment: Fila 0 en Columna 1 (segunda casilla)
     board[0] = 1; 
 
@@ -12,6 +12,19 @@
 #include <limits>
 #include <iomanip>
 
+#include "hda_star.h"
+#include "ida_star.h"
+#include "spill_search.h"
+#include "bidirectional_search.h"
+#include "parallel_bfs.h"
+#include "anytime_profile.h"
+#include "portfolio.h"
+#include "stepper.h"
+#include "state_intern.h"
+#include "approx_visited.h"
+#include "beam_search.h"
+#include "hanoi_problem.h"
+
 using namespace std;
 using namespace std::chrono;
 
@@ -34,6 +47,8 @@ struct Result {
     double duration_ms;
     bool found;
     long long solutions_count = 0;
+    string details = ""; // Detalles opcionales (iteraciones, tabla de transposición, ...)
+    string profile = ""; // Curva "ms:objetivo" de las búsquedas local / anytime
 };
 
 // --- Funciones auxiliares para Algoritmos de Búsqueda de Espacio de Estados ---
@@ -110,9 +125,35 @@ Result run_backtracking_hanoi(int N, int M) {
 }
 
 
+// --- Bucles heredados (b, c) en instancias grandes ---
+//
+// app.py corta cada programa a los 5 s. Los bucles b y c guardan cada estado
+// como vector<vector<int>> en un set/map y se detienen a los LEGACY_NODE_LIMIT
+// estados: si el espacio (N^M) es mayor, recorren ese límite entero (varios
+// segundos) y en la práctica no llegan al objetivo. Por defecto se omiten en
+// ese caso; SEARCH_HEAVY=1 los ejecuta igual. Los motores e-k corren siempre.
+const size_t LEGACY_NODE_LIMIT = 500000;
+
+bool heavy_mode() {
+    const char *mode = getenv("SEARCH_HEAVY");
+    return mode != nullptr && *mode != '\0' && *mode != '0';
+}
+
+bool legacy_search_enabled(int N, int M) {
+    return heavy_mode() || pow((double)N, M) <= (double)LEGACY_NODE_LIMIT;
+}
+
+string legacy_skipped(const string &name, int N, int M) {
+    ostringstream out;
+    out << name << " (Omitido: " << N << "^" << M << " estados > " << LEGACY_NODE_LIMIT
+        << " nodos, SEARCH_HEAVY=1 lo ejecuta)";
+    return out.str();
+}
+
 // b) BFS - Búsqueda por anchura (Garantiza el camino más corto en el espacio de estados)
 Result run_bfs_hanoi(int N, int M) {
     auto start = high_resolution_clock::now();
+    if (!legacy_search_enabled(N, M)) return {legacy_skipped("BFS", N, M), 0.0, false, 0};
     bool found = false;
 
     // Inicializar estado
@@ -121,26 +162,33 @@ Result run_bfs_hanoi(int N, int M) {
     for (int i = M; i >= 1; i--)
         start_state.towers[0].push_back(i);
 
-    queue<State> q;
+    queue<pair<State, int>> q; // (estado, profundidad)
     set<State> visited;
-    q.push(start_state);
+    q.push({start_state, 0});
     visited.insert(start_state);
 
     // ADVERTENCIA: Este algoritmo es muy lento. Limitamos el espacio de búsqueda.
-    const size_t MAX_NODES = 500000;
+    const size_t MAX_NODES = LEGACY_NODE_LIMIT;
     
     while (!q.empty()) {
-        State current = q.front(); q.pop();
+        State current = q.front().first;
+        int depth = q.front().second;
+        q.pop();
+        SEARCH_TRACE(TRACE_EXPAND, trace_hash_value(current.towers), depth, depth, -1);
 
         if (is_goal(current, M, N)) {
+            SEARCH_TRACE(TRACE_GOAL, trace_hash_value(current.towers), depth, depth, 0);
             found = true;
             break; 
         }
 
         for (auto &next : get_neighbors(current, N)) {
             if (!visited.count(next)) {
+                SEARCH_TRACE(TRACE_GENERATE, trace_hash_value(next.towers), depth + 1, depth + 1, -1);
                 visited.insert(next);
-                q.push(next);
+                q.push({next, depth + 1});
+            } else {
+                SEARCH_TRACE(TRACE_PRUNE, trace_hash_value(next.towers), depth + 1, depth + 1, -1);
             }
         }
         
@@ -178,6 +226,8 @@ int calculateHeuristic(const State& state, int numDisks, int numPegs) {
 
 Result run_a_star_hanoi(int N, int M) {
     auto start = high_resolution_clock::now();
+    if (!legacy_search_enabled(N, M)) return {legacy_skipped("A*", N, M), 0.0, false, 0};
+    AnytimeProfile profile; // Mejor objetivo vs. tiempo
     bool found = false;
     
     State start_state;
@@ -195,13 +245,16 @@ Result run_a_star_hanoi(int N, int M) {
     closed_set[start_state] = 0;
     
     long long visited_count = 0;
-    const size_t MAX_NODES = 500000;
+    const size_t MAX_NODES = LEGACY_NODE_LIMIT;
 
     while (!pq.empty()) {
         AStarState current = pq.top(); pq.pop();
         visited_count++;
+        profile.record(current.h);
+        SEARCH_TRACE(TRACE_EXPAND, trace_hash_value(current.state.towers), current.g, current.g, current.h);
 
         if (is_goal(current.state, M, N)) {
+            SEARCH_TRACE(TRACE_GOAL, trace_hash_value(current.state.towers), current.g, current.g, 0);
             found = true;
             break; 
         }
@@ -217,8 +270,11 @@ Result run_a_star_hanoi(int N, int M) {
                 
                 int h_successor = calculateHeuristic(next_state, M, N);
                 AStarState next_astar = {next_state, g_successor, h_successor, g_successor + h_successor};
+                SEARCH_TRACE(TRACE_GENERATE, trace_hash_value(next_state.towers), g_successor, g_successor, h_successor);
                 
                 pq.push(next_astar);
+            } else {
+                SEARCH_TRACE(TRACE_PRUNE, trace_hash_value(next_state.towers), g_successor, g_successor, -1);
             }
         }
         
@@ -226,16 +282,19 @@ Result run_a_star_hanoi(int N, int M) {
     }
 
     auto end = high_resolution_clock::now();
-    return {"A* (Informed Search)", 
+    Result result = {"A* (Informed Search)", 
             duration_cast<microseconds>(end - start).count() / 1000.0, 
             found,
             visited_count};
+    result.profile = profile.to_string();
+    return result;
 }
 
 
 // d) Hill Climbing - Búsqueda Local (Simplificado, puede quedar en máximo local)
 Result run_hill_climbing_hanoi(int N, int M) {
     auto start = high_resolution_clock::now();
+    AnytimeProfile profile; // Mejor objetivo vs. tiempo
     bool found = false;
     
     // Inicialización del estado: todos los discos en el poste de origen
@@ -246,6 +305,7 @@ Result run_hill_climbing_hanoi(int N, int M) {
     }
     
     int current_heuristic = calculateHeuristic(current_state, M, N);
+    profile.record(current_heuristic);
     int iterations = 0;
     const int MAX_ITERATIONS = 50000; 
 
@@ -270,6 +330,7 @@ Result run_hill_climbing_hanoi(int N, int M) {
         if (improved) {
             current_state = best_neighbor;
             current_heuristic = best_H;
+            profile.record(current_heuristic);
         } else {
             // Máximo local (o meseta): no hay mejora. Se detiene.
             break;
@@ -281,14 +342,250 @@ Result run_hill_climbing_hanoi(int N, int M) {
     }
 
     auto end = high_resolution_clock::now();
-    return {"Hill Climbing (Local Search)", 
+    Result result = {"Hill Climbing (Local Search)", 
             duration_cast<microseconds>(end - start).count() / 1000.0, 
             found,
             (long long)iterations};
+    result.profile = profile.to_string();
+    return result;
+}
+
+// Presupuesto de expansiones de IDA*. Sin conjunto de visitados, con 3 postes
+// revisita los mismos estados por muchos caminos (3x10: ~12M expansiones); con
+// 4 postes la base de patrones lo guía bien (4x11: ~3M). Al agotarse devuelve
+// "No" en lugar de consumir el tiempo de los demás; SEARCH_HEAVY=1 lo amplía.
+const long long IDA_NODE_LIMIT = 4000000;
+const long long IDA_HEAVY_NODE_LIMIT = 50000000;
+
+// e) HDA* - A* paralelo distribuido por hash (usa todos los núcleos)
+Result run_hda_star_hanoi(int N, int M) {
+    auto start = high_resolution_clock::now();
+    if (N > 4 || M > 32) return {"HDA* (Inviable para N > 4 o M > 32)", 0.0, false, 0};
+
+    HanoiProblem problem(N, M);
+    SearchStats stats = hda_star(problem, 0, 5000000);
+
+    auto end = high_resolution_clock::now();
+    return {"HDA* (A* Paralelo)", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.found,
+            stats.expanded};
+}
+
+/**
+ * @brief Resume iteraciones, nodos por iteración y tasa de aciertos de la tabla de transposición.
+ */
+string ida_details(const IdaStats &stats) {
+    ostringstream out;
+    out << stats.iterations << " iteraciones, costo " << stats.cost << ", nodos/iteración [";
+    size_t n = stats.nodes_per_iteration.size();
+    for (size_t i = 0; i < n; i++) {
+        if (n > 16 && i == 8) { out << " ..."; i = n - 8; } // Solo las primeras y últimas 8
+        out << (i ? " " : "") << stats.nodes_per_iteration[i];
+    }
+    out << "], aciertos TT " << fixed << setprecision(1) << 100.0 * stats.tt_hit_rate() << "%";
+    return out.str();
+}
+
+// f) IDA* - Profundización iterativa: memoria O(profundidad) + tabla de transposición fija
+Result run_ida_star_hanoi(int N, int M) {
+    auto start = high_resolution_clock::now();
+    if (N > 4 || M > 32) return {"IDA* (Inviable para N > 4 o M > 32)", 0.0, false, 0};
+
+    HanoiProblem problem(N, M);
+    long long node_limit = heavy_mode() ? IDA_HEAVY_NODE_LIMIT : IDA_NODE_LIMIT;
+    IdaStats stats = ida_star(problem, 1 << 21, node_limit); // Tabla de 2M entradas (~32 MB)
+
+    auto end = high_resolution_clock::now();
+    string details = ida_details(stats);
+    if (!stats.found && stats.expanded > node_limit)
+        details += ", límite de " + to_string(node_limit) + " expansiones agotado (SEARCH_HEAVY=1 lo amplía)";
+    return {"IDA* (Memoria Acotada)", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.found,
+            stats.expanded,
+            details};
+}
+
+// g) A* con memoria acotada - La frontera que no cabe en RAM se vuelca a disco
+Result run_spill_a_star_hanoi(int N, int M) {
+    auto start = high_resolution_clock::now();
+    if (N > 4 || M > 32) return {"A* Externo (Inviable para N > 4 o M > 32)", 0.0, false, 0};
+
+    HanoiProblem problem(N, M);
+    const size_t RAM_BUDGET = 1 << 20; // 1 MB de frontera en memoria (~65k nodos)
+    SpillStats stats = spill_search(problem, RAM_BUDGET);
+
+    auto end = high_resolution_clock::now();
+    ostringstream details;
+    details << "costo " << stats.cost << ", " << stats.spilled_nodes << " nodos volcados a disco en "
+            << stats.runs << " corridas (" << stats.merges << " mezclas), pico en RAM " << stats.peak_in_memory
+            << " nodos / " << stats.peak_resident_bytes / 1024 << " KB";
+    if (stats.spill_failed) details << ", FALLO de disco (frontera en RAM" << (stats.truncated ? ", nodos perdidos)" : ")");
+    return {"A* Externo (Frontera en Disco)", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.found,
+            stats.expanded,
+            details.str()};
+}
+
+// h) BFS Bidireccional - Encuentro en el medio entre el inicio y el objetivo explícito
+Result run_bidirectional_bfs_hanoi(int N, int M) {
+    auto start = high_resolution_clock::now();
+    if (N > 4 || M > 32) return {"BFS Bidireccional (Inviable para N > 4 o M > 32)", 0.0, false, 0};
+
+    HanoiProblem problem(N, M);
+    BidirStats<HanoiProblem::State> stats = bidirectional_bfs(problem);
+
+    // Verificar el camino reconstruido: cada paso debe ser un movimiento legal.
+    bool path_ok = stats.found && (int)stats.path.size() == stats.cost + 1;
+    for (size_t i = 1; path_ok && i < stats.path.size(); i++) {
+        bool legal = false;
+        problem.expand(stats.path[i - 1], [&](HanoiProblem::State next, int) { legal |= (next == stats.path[i]); });
+        path_ok = legal;
+    }
+
+    auto end = high_resolution_clock::now();
+    ostringstream details;
+    if (stats.found) {
+        details << "costo " << stats.cost << ", encuentro tras " << stats.forward_depth << " + " << stats.backward_depth
+                << " movimientos en " << problem.describe(stats.meeting) << ", camino " << (path_ok ? "verificado" : "INVÁLIDO");
+    }
+    details << (stats.found ? ", " : "") << "explorados " << stats.forward_states << " (inicio) + " << stats.backward_states << " (objetivo)";
+    return {"BFS Bidireccional (Encuentro en el Medio)", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.found && path_ok,
+            stats.forward_states + stats.backward_states,
+            details.str()};
+}
+
+// i) BFS Paralelo - Síncrono por niveles, frontera empaquetada y deduplicación por hash
+Result run_parallel_bfs_hanoi(int N, int M) {
+    auto start = high_resolution_clock::now();
+    if (N > 4 || M > 32) return {"BFS Paralelo (Inviable para N > 4 o M > 32)", 0.0, false, 0};
+
+    HanoiProblem problem(N, M);
+    ParallelBfsStats stats = parallel_bfs(problem, 0, 5000000);
+
+    auto end = high_resolution_clock::now();
+    ostringstream details;
+    details << "costo " << stats.cost << ", " << stats.levels << " niveles, frontera máxima " << stats.peak_frontier
+            << " estados, " << stats.threads << " hilos";
+    return {"BFS Paralelo (Por Niveles)", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.found,
+            stats.visited,
+            details.str()};
+}
+
+// j) BFS Aproximado - Visitados en un filtro de Bloom (pocos bits por estado, completitud probabilística)
+Result run_approx_bfs_hanoi(int N, int M) {
+    auto start = high_resolution_clock::now();
+    if (N > 4 || M > 32) return {"BFS Aproximado (Inviable para N > 4 o M > 32)", 0.0, false, 0};
+
+    HanoiProblem problem(N, M);
+    long long space = 1;
+    for (int d = 0; d < M && space < 5000000; d++) space *= N; // N^M estados, el filtro no necesita más
+    ApproxBfsStats stats = approx_bfs(problem, min(space, 5000000LL), 1e-3);
+
+    auto end = high_resolution_clock::now();
+    ostringstream details;
+    details << "costo " << stats.cost << " (cota superior), filtro " << stats.filter_bytes / 1024 << " KB para "
+            << stats.visited << " estados, falsos positivos ~" << setprecision(2) << scientific
+            << stats.false_positive_rate << ": completitud probabilística";
+    return {"BFS Aproximado (Bloom, Probabilístico)", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.found,
+            stats.visited,
+            details.str()};
+}
+
+// k) Beam Search - Capas de ancho fijo: memoria acotada y solución (quizá subóptima) en tiempo previsible
+Result run_beam_search_hanoi(int N, int M) {
+    auto start = high_resolution_clock::now();
+    if (N > 4 || M > 32) return {"Beam Search (Inviable para N > 4 o M > 32)", 0.0, false, 0};
+
+    HanoiProblem problem(N, M);
+    BeamOptions options;
+    options.width = 1000;
+    options.max_depth = 1 << min(M, 20); // Con 3 postes la solución óptima tiene 2^M - 1 movimientos
+    BeamStats stats = beam_search(problem, options);
+
+    auto end = high_resolution_clock::now();
+    ostringstream details;
+    details << "costo " << stats.cost << " (no necesariamente óptimo), ancho " << options.width << ", "
+            << stats.levels << " capas, " << stats.dropped << " hijos descartados";
+    return {"Beam Search (Ancho 1000)", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.found,
+            stats.expanded,
+            details.str()};
 }
 
 // --- 3. Bloque Principal de Ejecución y Selector de Óptimo ---
 
+// --- Modo portafolio (portfolio.h): la primera solución gana y cancela al resto ---
+
+/**
+ * @brief Corre en paralelo los motores cancelables del núcleo e imprime el primero que resuelve.
+ */
+void run_portfolio_hanoi(int N, int M) {
+    if (N > 4 || M > 32) {
+        print_portfolio(PortfolioResult());
+        return;
+    }
+    int threads = portfolio_threads_per_entry(5);
+    HanoiProblem base(N, M); // La tabla de patrones se construye una vez y se copia a cada motor
+    auto cost_note = [](const SearchStats &stats) { return stats.found ? "costo " + to_string(stats.cost) : string(); };
+    vector<PortfolioEntry> entries;
+    entries.push_back({"HDA* (A* Paralelo)", [&](const StopToken &token) {
+        CancellableProblem<HanoiProblem> problem(base, token);
+        SearchStats stats = hda_star(problem, threads, 5000000);
+        return PortfolioOutcome{stats.found, stats.expanded, cost_note(stats)};
+    }});
+    entries.push_back({"IDA* (Memoria Acotada)", [&](const StopToken &token) {
+        CancellableProblem<HanoiProblem> problem(base, token);
+        IdaStats stats = ida_star(problem, 1 << 21, 50000000);
+        return PortfolioOutcome{stats.found, stats.expanded, cost_note(stats)};
+    }});
+    entries.push_back({"A* Externo (Frontera en Disco)", [&](const StopToken &token) {
+        CancellableProblem<HanoiProblem> problem(base, token);
+        SpillStats stats = spill_search(problem, 1 << 20);
+        return PortfolioOutcome{stats.found, stats.expanded, cost_note(stats)};
+    }});
+    entries.push_back({"BFS Bidireccional (Encuentro en el Medio)", [&](const StopToken &token) {
+        CancellableProblem<HanoiProblem> problem(base, token);
+        BidirStats<HanoiProblem::State> stats = bidirectional_bfs(problem);
+        return PortfolioOutcome{stats.found, stats.expanded, cost_note(stats)};
+    }});
+    entries.push_back({"BFS Paralelo (Por Niveles)", [&](const StopToken &token) {
+        CancellableProblem<HanoiProblem> problem(base, token);
+        ParallelBfsStats stats = parallel_bfs(problem, threads, 5000000, CheckpointConfig());
+        return PortfolioOutcome{stats.found, stats.expanded, cost_note(stats)};
+    }});
+    print_portfolio(run_portfolio(entries));
+}
+
+// Modo lockstep: todos los motores avanzan por turnos en un hilo con el mismo cuanto
+void run_lockstep_hanoi(int N, int M, long long quantum) {
+    if (N > 4 || M > 32) {
+        print_lockstep(LockstepResult());
+        return;
+    }
+    HanoiProblem problem(N, M);
+    InternedProblem<HanoiProblem> shared(problem); // A* y BFS comparten estados, h y sucesores
+    BeamOptions beam;
+    beam.width = 1000;
+    beam.max_depth = 1 << min(M, 20);
+    vector<LockstepEntry> entries;
+    entries.push_back(make_lockstep_entry("A* (Por Pasos)", make_shared<AStarStepper<InternedProblem<HanoiProblem>>>(shared)));
+    entries.push_back(make_lockstep_entry("IDA* (Por Pasos)", make_shared<IdaStarStepper<HanoiProblem>>(problem)));
+    entries.push_back(make_lockstep_entry("BFS (Por Pasos)", make_shared<BfsStepper<InternedProblem<HanoiProblem>>>(shared)));
+    entries.push_back(make_lockstep_entry("Beam Search (Por Pasos)", make_shared<BeamStepper<HanoiProblem>>(problem, beam)));
+    print_lockstep(run_lockstep(entries, quantum, 5000000));
+    print_intern_stats(shared.stats());
+}
+
 int main() {
     // 1. Fijar N y M (3 postes, 8 discos)
     const int N_PEGS = 3; 
@@ -301,6 +598,18 @@ int main() {
     // Validaciones
     cout << "\nEjecutando algoritmos para " << N_PEGS << " postes y " << M_DISKS << " discos..." << endl;
     
+    // Modo portafolio (SEARCH_PORTFOLIO=1): la primera solución válida gana
+    if (portfolio_mode()) {
+        run_portfolio_hanoi(N_PEGS, M_DISKS);
+        return 0;
+    }
+
+    // Modo lockstep (SEARCH_LOCKSTEP=<cuanto>): mismo presupuesto de trabajo para todos
+    if (lockstep_quantum() > 0) {
+        run_lockstep_hanoi(N_PEGS, M_DISKS, lockstep_quantum());
+        return 0;
+    }
+
     // 2. Lista de resultados para la comparación
     vector<Result> results;
     
@@ -309,6 +618,13 @@ int main() {
     results.push_back(run_bfs_hanoi(N_PEGS, M_DISKS));         // Lento: Explora espacio de estados
     results.push_back(run_a_star_hanoi(N_PEGS, M_DISKS));      // Lento: Explora espacio de estados (informada)
     results.push_back(run_hill_climbing_hanoi(N_PEGS, M_DISKS)); // Rápido: Búsqueda local
+    results.push_back(run_hda_star_hanoi(N_PEGS, M_DISKS));    // Paralelo: A* en todos los núcleos
+    results.push_back(run_ida_star_hanoi(N_PEGS, M_DISKS));    // Memoria O(profundidad): sin set<State>/map<State,int>
+    results.push_back(run_spill_a_star_hanoi(N_PEGS, M_DISKS)); // Memoria acotada: frontera en disco
+    results.push_back(run_bidirectional_bfs_hanoi(N_PEGS, M_DISKS)); // Encuentro en el medio
+    results.push_back(run_parallel_bfs_hanoi(N_PEGS, M_DISKS)); // BFS por niveles en todos los núcleos
+    results.push_back(run_approx_bfs_hanoi(N_PEGS, M_DISKS));   // Visitados en filtro de Bloom (probabilístico)
+    results.push_back(run_beam_search_hanoi(N_PEGS, M_DISKS));  // Ancho fijo: memoria acotada, quizá subóptimo
 
     // 3. Análisis y Selector de Óptimo
 
@@ -334,6 +650,16 @@ int main() {
     }
     cout << "--------------------------------------------------------------------------------" << endl;
 
+    // Detalles adicionales de los motores del núcleo de búsqueda
+    for (const auto& res : results) {
+        if (!res.details.empty()) cout << "   * " << res.name << ": " << res.details << endl;
+    }
+
+    // Curvas calidad vs. tiempo (búsqueda local / anytime)
+    for (const auto& res : results) {
+        if (!res.profile.empty()) cout << "   ~ " << res.name << ": " << res.profile << endl;
+    }
+
     // Mostrar el algoritmo óptimo
     if (optimal_result.duration_ms != numeric_limits<double>::max()) {
         cout << "\n🏆 ALGORITMO MÁS RÁPIDO PARA HANÓI (N=" << N_PEGS << ", M=" << M_DISKS << "):" << endl;
@@ -19,6 +19,15 @@ Este es ideal para probar algoritmos como BFS o A*, ya que en tableros pequeños
 #include <array>
 #include <random>
 
+#include "hda_star.h"
+#include "ida_star.h"
+#include "parallel_bfs.h"
+#include "simulated_annealing.h"
+#include "portfolio.h"
+#include "stepper.h"
+#include "state_intern.h"
+#include "beam_search.h"
+
 using namespace std;
 using namespace std::chrono;
 
@@ -34,6 +43,7 @@ struct Result {
     double duration_ms;
     bool found;
     long long metric_value = 0; // Se usa para nodos visitados o pasos
+    string details = ""; // Detalles opcionales (iteraciones, tabla de transposición, ...)
 };
 
 // ... (Resto de funciones auxiliares is_valid_position y count_possible_moves igual que el original) ...
@@ -108,7 +118,12 @@ Result run_a_star_knight(int N, int startX, int startY) {
     while (!pq.empty()) {
         AStarNode current = pq.top(); pq.pop();
         nodes_visited++;
-        if (current.g == N * N) { found = true; break; }
+        SEARCH_TRACE(TRACE_EXPAND, trace_hash_value(current.board), current.g - 1, current.g, current.h);
+        if (current.g == N * N) {
+            SEARCH_TRACE(TRACE_GOAL, trace_hash_value(current.board), current.g - 1, current.g, 0);
+            found = true;
+            break;
+        }
         int g_successor = current.g + 1;
         for (int i = 0; i < 8; ++i) {
             int nx = current.x + movX[i];
@@ -118,6 +133,7 @@ Result run_a_star_knight(int N, int startX, int startY) {
                 new_board[nx][ny] = g_successor;
                 int h_successor = count_possible_moves(nx, ny, N, new_board);
                 AStarNode successor_node = {nx, ny, g_successor, h_successor, 0, new_board};
+                SEARCH_TRACE(TRACE_GENERATE, trace_hash_value(new_board), g_successor - 1, g_successor, h_successor);
                 pq.push(successor_node);
             }
         }
@@ -193,16 +209,29 @@ Result run_bfs_knight(int N, int startX, int startY) {
     q.push(start_state);
     visited_set.insert(start_state);
 
+    // Traza: hash de las casillas visitadas y la posición; profundidad = casillas visitadas - 1.
+    auto trace_key = [&](const BFSState &s) { return trace_hash_value(s.visited) * 31 + (uint64_t)(s.x * N + s.y); };
+    auto trace_depth = [&](const BFSState &s) {
+        int depth = -1;
+        for (const auto &row : s.visited) depth += (int)count(row.begin(), row.end(), true);
+        return depth;
+    };
+
     while (!q.empty()) {
         BFSState current = q.front(); q.pop();
         nodes_visited++;
+        SEARCH_TRACE(TRACE_EXPAND, trace_key(current), trace_depth(current), trace_depth(current), -1);
         bool all_visited = true;
         for (int i = 0; i < N; ++i) {
             for (int j = 0; j < N; ++j) {
                 if (!current.visited[i][j]) { all_visited = false; break; }
             }
         }
-        if (all_visited) { found = true; break; }
+        if (all_visited) {
+            SEARCH_TRACE(TRACE_GOAL, trace_key(current), trace_depth(current), trace_depth(current), 0);
+            found = true;
+            break;
+        }
 
         for (int i = 0; i < 8; i++) {
             int nx = current.x + movX[i];
@@ -212,8 +241,11 @@ Result run_bfs_knight(int N, int startX, int startY) {
                 ns.x = nx; ns.y = ny;
                 ns.visited[nx][ny] = true;
                 if (visited_set.find(ns) == visited_set.end()) {
+                    SEARCH_TRACE(TRACE_GENERATE, trace_key(ns), trace_depth(ns), trace_depth(ns), -1);
                     visited_set.insert(ns);
                     q.push(ns);
+                } else {
+                    SEARCH_TRACE(TRACE_PRUNE, trace_key(ns), trace_depth(ns), trace_depth(ns), -1);
                 }
             }
         }
@@ -225,6 +257,322 @@ Result run_bfs_knight(int N, int startX, int startY) {
 
 // --- 3. Bloque Principal MODIFICADO (Sin CIN) ---
 
+// --- Adaptador para el núcleo de búsqueda genérico (search_core.h) ---
+
+/**
+ * @brief Recorrido del caballo con estado empaquetado: máscara de 64 bits de casillas visitadas
+ * más la casilla actual (N <= 8).
+ */
+struct KnightProblem {
+    struct State {
+        uint64_t visited;
+        int pos; // x * N + y
+        bool operator==(const State &other) const { return visited == other.visited && pos == other.pos; }
+    };
+    int N, startX, startY;
+    uint64_t full;
+    vector<uint64_t> jumps; // jumps[p] = casillas alcanzables desde p
+
+    KnightProblem(int n, int sx, int sy) : N(n), startX(sx), startY(sy), jumps(n * n, 0) {
+        full = (N * N == 64) ? ~0ULL : ((1ULL << (N * N)) - 1);
+        for (int x = 0; x < N; ++x) {
+            for (int y = 0; y < N; ++y) {
+                for (int k = 0; k < 8; ++k) {
+                    int nx = x + movX[k], ny = y + movY[k];
+                    if (nx >= 0 && nx < N && ny >= 0 && ny < N) jumps[x * N + y] |= 1ULL << (nx * N + ny);
+                }
+            }
+        }
+    }
+
+    State initial() const { int p = startX * N + startY; return {1ULL << p, p}; }
+    bool is_goal(const State &s) const { return s.visited == full; }
+    uint64_t hash(const State &s) const { return s.visited * 0x9e3779b97f4a7c15ULL + s.pos; }
+    // Parámetros de la instancia para la huella de los checkpoints (checkpoint.h).
+    uint64_t fingerprint() const { return checkpoint_hash({(uint64_t)N, (uint64_t)startX, (uint64_t)startY}); }
+
+    // Casillas restantes (cada una cuesta un salto). Poda callejones sin salida: una casilla libre
+    // sin vecinos libres es inalcanzable, y solo una casilla de grado 1 puede ser el final del recorrido.
+    int heuristic(const State &s) const {
+        uint64_t free_sq = full & ~s.visited;
+        int remaining = 0, dead_ends = 0;
+        for (uint64_t m = free_sq; m; m &= m - 1) {
+            int q = __builtin_ctzll(m);
+            remaining++;
+            int degree = __builtin_popcountll(jumps[q] & free_sq) + ((jumps[q] >> s.pos) & 1);
+            if (degree == 0) return SEARCH_INF;
+            if (degree == 1 && !((jumps[s.pos] >> q) & 1)) dead_ends++;
+        }
+        return dead_ends > 1 ? SEARCH_INF : remaining;
+    }
+
+    template <class Visit>
+    void expand(const State &s, Visit &&visit) const {
+        for (uint64_t m = jumps[s.pos] & ~s.visited; m; m &= m - 1) {
+            int q = __builtin_ctzll(m);
+            visit(State{s.visited | (1ULL << q), q}, 1);
+        }
+    }
+
+    // Interfaz de movimientos en el sitio (IDA*): aplicar y deshacer sin copiar el estado.
+    struct Move { int from, to; };
+    static const int MAX_MOVES = 8;
+    int moves(const State &s, Move *out) const {
+        int n = 0;
+        for (uint64_t m = jumps[s.pos] & ~s.visited; m; m &= m - 1) out[n++] = {s.pos, __builtin_ctzll(m)};
+        return n;
+    }
+    void apply(State &s, const Move &m) const { s.visited |= 1ULL << m.to; s.pos = m.to; }
+    void undo(State &s, const Move &m) const { s.visited &= ~(1ULL << m.to); s.pos = m.from; }
+};
+
+// f) HDA* - A* paralelo distribuido por hash (usa todos los núcleos)
+Result run_hda_star_knight(int N, int startX, int startY) {
+    auto start_time = high_resolution_clock::now();
+    if (N > 8) return {"HDA* (Inviable para N > 8)", 0.0, false, 0};
+
+    KnightProblem problem(N, startX, startY);
+    SearchStats stats = hda_star(problem, 0, 1000000);
+
+    auto end_time = high_resolution_clock::now();
+    return {"HDA* (A* Paralelo)", duration_cast<microseconds>(end_time - start_time).count() / 1000.0, stats.found, stats.expanded};
+}
+
+/**
+ * @brief Resume iteraciones, nodos por iteración y tasa de aciertos de la tabla de transposición.
+ */
+string ida_details(const IdaStats &stats) {
+    ostringstream out;
+    out << stats.iterations << " iteraciones, costo " << stats.cost << ", nodos/iteración [";
+    size_t n = stats.nodes_per_iteration.size();
+    for (size_t i = 0; i < n; i++) {
+        if (n > 16 && i == 8) { out << " ..."; i = n - 8; } // Solo las primeras y últimas 8
+        out << (i ? " " : "") << stats.nodes_per_iteration[i];
+    }
+    out << "], aciertos TT " << fixed << setprecision(1) << 100.0 * stats.tt_hit_rate() << "%";
+    return out.str();
+}
+
+// g) IDA* - Profundización iterativa con tabla de transposición fija
+Result run_ida_star_knight(int N, int startX, int startY) {
+    auto start_time = high_resolution_clock::now();
+    if (N > 8) return {"IDA* (Inviable para N > 8)", 0.0, false, 0};
+
+    KnightProblem problem(N, startX, startY);
+    IdaStats stats = ida_star(problem, 1 << 20, 10000000);
+
+    auto end_time = high_resolution_clock::now();
+    return {"IDA* (Memoria Acotada)", duration_cast<microseconds>(end_time - start_time).count() / 1000.0, stats.found, stats.expanded, ida_details(stats)};
+}
+
+// h) BFS Paralelo - Síncrono por niveles con frontera empaquetada (16 bytes por estado)
+Result run_parallel_bfs_knight(int N, int startX, int startY) {
+    auto start_time = high_resolution_clock::now();
+    if (N > 8) return {"BFS Paralelo (Inviable para N > 8)", 0.0, false, 0};
+
+    KnightProblem problem(N, startX, startY);
+    ParallelBfsStats stats = parallel_bfs(problem, 0, 2000000);
+
+    auto end_time = high_resolution_clock::now();
+    return {"BFS Paralelo (Por Niveles)", duration_cast<microseconds>(end_time - start_time).count() / 1000.0, stats.found, stats.visited};
+}
+
+// --- Adaptador para el recocido simulado (simulated_annealing.h) ---
+
+// Recorrido como permutación de casillas con la primera fija en el inicio; el
+// costo es el número de pasos consecutivos que no son salto de caballo.
+// Un movimiento invierte un tramo (2-opt) elegido para que un vecino de caballo
+// quede pegado a una casilla: solo cambian dos aristas, así que el delta es O(1).
+// Las casillas tocadas por pasos inválidos se guardan en un conjunto indexado
+// para concentrar las propuestas donde está el problema.
+class KnightAnnealing {
+public:
+    struct Move { int i, j; }; // Invertir order[i..j] (i == j: movimiento nulo)
+
+    KnightAnnealing(int N, int startX, int startY, SaRng &rng)
+        : N(N), order(N * N), pos(N * N), bad_degree(N * N, 0), slot(N * N, -1) {
+        int start = startX * N + startY;
+        for (int k = 0; k < N * N; ++k) order[k] = k;
+        swap(order[0], order[start]);
+        for (int k = N * N - 1; k > 1; --k) swap(order[k], order[1 + rng.below(k)]);
+        for (int k = 0; k < N * N; ++k) pos[order[k]] = k;
+        for (int k = 0; k + 1 < N * N; ++k) mark(order[k], order[k + 1], +1);
+    }
+
+    long long cost() const { return bad_steps; }
+
+    Move propose(SaRng &rng) const {
+        int n = N * N;
+        int p = bad_squares.empty() || rng.below(2) ? rng.below(n) : pos[bad_squares[rng.below((int)bad_squares.size())]];
+        int sq = order[p], x = sq / N, y = sq % N;
+        int k = rng.below(8);
+        int nx = x + movX[k], ny = y + movY[k];
+        if (nx < 0 || nx >= N || ny < 0 || ny >= N) return {0, 0};
+        int r = pos[nx * N + ny];
+        if (r > p + 1) return {p + 1, r};    // Tras invertir, order[p + 1] es el vecino
+        if (r >= 1 && r < p - 1) return {r, p - 1}; // Tras invertir, order[p - 1] es el vecino
+        return {0, 0};
+    }
+
+    long long delta(const Move &m) const {
+        if (m.i >= m.j) return 0;
+        int n = N * N;
+        long long d = bad(order[m.i - 1], order[m.j]) - bad(order[m.i - 1], order[m.i]);
+        if (m.j + 1 < n) d += bad(order[m.i], order[m.j + 1]) - bad(order[m.j], order[m.j + 1]);
+        return d;
+    }
+
+    void apply(const Move &m) {
+        if (m.i >= m.j) return;
+        int n = N * N;
+        // Solo cambian las dos aristas de los extremos del tramo.
+        mark(order[m.i - 1], order[m.i], -1);
+        mark(order[m.i - 1], order[m.j], +1);
+        if (m.j + 1 < n) {
+            mark(order[m.j], order[m.j + 1], -1);
+            mark(order[m.i], order[m.j + 1], +1);
+        }
+        reverse(order.begin() + m.i, order.begin() + m.j + 1);
+        for (int k = m.i; k <= m.j; ++k) pos[order[k]] = k;
+    }
+
+private:
+    int bad(int a, int b) const {
+        int dx = abs(a / N - b / N), dy = abs(a % N - b % N);
+        return (dx == 1 && dy == 2) || (dx == 2 && dy == 1) ? 0 : 1;
+    }
+
+    // Suma (+1) o resta (-1) la arista a-b si es inválida y actualiza el conjunto de casillas.
+    void mark(int a, int b, int sign) {
+        if (!bad(a, b)) return;
+        bad_steps += sign;
+        for (int sq : {a, b}) {
+            bad_degree[sq] += sign;
+            if (bad_degree[sq] > 0 && slot[sq] < 0) {
+                slot[sq] = (int)bad_squares.size();
+                bad_squares.push_back(sq);
+            } else if (bad_degree[sq] == 0 && slot[sq] >= 0) {
+                int last = bad_squares.back();
+                bad_squares[slot[sq]] = last;
+                slot[last] = slot[sq];
+                bad_squares.pop_back();
+                slot[sq] = -1;
+            }
+        }
+    }
+
+    int N;
+    vector<int> order; // Casilla (x * N + y) visitada en cada paso
+    vector<int> pos;   // Paso en que se visita cada casilla
+    vector<int> bad_degree;  // Pasos inválidos que tocan cada casilla
+    vector<int> bad_squares; // Casillas con bad_degree > 0
+    vector<int> slot;        // Posición de cada casilla en bad_squares (-1 = fuera)
+    long long bad_steps = 0;
+};
+
+// i) Recocido Simulado - Búsqueda local sobre permutaciones de casillas
+Result run_simulated_annealing_knight(int N, int startX, int startY) {
+    auto start_time = high_resolution_clock::now();
+    SaRng rng(std::chrono::system_clock::now().time_since_epoch().count());
+
+    KnightAnnealing problem(N, startX, startY, rng);
+    SaOptions options;
+    options.max_iterations = max(2000000LL, 2000LL * N * N);
+    options.reheat_after = max(20000LL, 100LL * N * N);
+    options.seed = rng.next();
+    SaStats stats = simulated_annealing(problem, GeometricCooling{0.6, 0.99999}, options);
+
+    auto end_time = high_resolution_clock::now();
+    ostringstream details;
+    details << "mejor costo " << stats.best_cost << " (pasos inválidos), " << stats.accepted << " movimientos aceptados de "
+            << stats.iterations << ", " << stats.reheats << " recalentamientos";
+    return {"Recocido Simulado (2-opt, Delta O(1))", duration_cast<microseconds>(end_time - start_time).count() / 1000.0,
+            stats.found, stats.iterations, details.str()};
+}
+
+// j) Beam Search - Capas de ancho fijo: memoria acotada y solución en tiempo previsible
+Result run_beam_search_knight(int N, int startX, int startY) {
+    auto start_time = high_resolution_clock::now();
+    if (N > 8) return {"Beam Search (Inviable para N > 8)", 0.0, false, 0};
+
+    KnightProblem problem(N, startX, startY);
+    BeamOptions options;
+    options.width = 1000;
+    options.max_depth = N * N; // Un recorrido completo tiene N*N - 1 saltos
+    BeamStats stats = beam_search(problem, options);
+
+    auto end_time = high_resolution_clock::now();
+    ostringstream details;
+    details << "ancho " << options.width << ", " << stats.levels << " capas, " << stats.dropped << " hijos descartados";
+    return {"Beam Search (Ancho 1000)", duration_cast<microseconds>(end_time - start_time).count() / 1000.0, stats.found, stats.expanded, details.str()};
+}
+
+// --- Modo portafolio (portfolio.h): la primera solución gana y cancela al resto ---
+
+/**
+ * @brief Corre en paralelo los algoritmos cancelables e imprime el primero que resuelve.
+ */
+void run_portfolio_knight(int N, int startX, int startY) {
+    int threads = portfolio_threads_per_entry(4);
+    vector<PortfolioEntry> entries;
+    if (N <= 8) {
+        entries.push_back({"HDA* (A* Paralelo)", [&](const StopToken &token) {
+            CancellableProblem<KnightProblem> problem(KnightProblem(N, startX, startY), token);
+            SearchStats stats = hda_star(problem, threads, 1000000);
+            return PortfolioOutcome{stats.found, stats.expanded};
+        }});
+        entries.push_back({"IDA* (Memoria Acotada)", [&](const StopToken &token) {
+            CancellableProblem<KnightProblem> problem(KnightProblem(N, startX, startY), token);
+            IdaStats stats = ida_star(problem, 1 << 20, 10000000);
+            return PortfolioOutcome{stats.found, stats.expanded};
+        }});
+        entries.push_back({"BFS Paralelo (Por Niveles)", [&](const StopToken &token) {
+            CancellableProblem<KnightProblem> problem(KnightProblem(N, startX, startY), token);
+            ParallelBfsStats stats = parallel_bfs(problem, threads, 2000000, CheckpointConfig());
+            return PortfolioOutcome{stats.found, stats.expanded};
+        }});
+    }
+    entries.push_back({"Recocido Simulado (2-opt, Delta O(1))", [&](const StopToken &token) {
+        SaRng rng(std::chrono::system_clock::now().time_since_epoch().count());
+        KnightAnnealing problem(N, startX, startY, rng);
+        SaOptions options;
+        options.max_iterations = max(2000000LL, 2000LL * N * N);
+        options.reheat_after = max(20000LL, 100LL * N * N);
+        options.seed = rng.next();
+        options.stop = token.flag();
+        SaStats stats = simulated_annealing(problem, GeometricCooling{0.6, 0.99999}, options);
+        return PortfolioOutcome{stats.found, stats.iterations};
+    }});
+    print_portfolio(run_portfolio(entries));
+}
+
+// Modo lockstep: todos los motores avanzan por turnos en un hilo con el mismo cuanto
+void run_lockstep_knight(int N, int startX, int startY, long long quantum) {
+    KnightProblem problem(N, startX, startY);
+    InternedProblem<KnightProblem> shared(problem); // A* y BFS comparten estados, h y sucesores
+    SaRng rng(std::chrono::system_clock::now().time_since_epoch().count());
+    KnightAnnealing annealing(N, startX, startY, rng);
+    SaOptions options;
+    options.max_iterations = max(2000000LL, 2000LL * N * N);
+    options.reheat_after = max(20000LL, 100LL * N * N);
+    options.seed = rng.next();
+
+    vector<LockstepEntry> entries;
+    if (N <= 8) {
+        entries.push_back(make_lockstep_entry("A* (Por Pasos)", make_shared<AStarStepper<InternedProblem<KnightProblem>>>(shared)));
+        entries.push_back(make_lockstep_entry("IDA* (Por Pasos)", make_shared<IdaStarStepper<KnightProblem>>(problem)));
+        entries.push_back(make_lockstep_entry("BFS (Por Pasos)", make_shared<BfsStepper<InternedProblem<KnightProblem>>>(shared)));
+        BeamOptions beam;
+        beam.width = 1000;
+        beam.max_depth = N * N;
+        entries.push_back(make_lockstep_entry("Beam Search (Por Pasos)", make_shared<BeamStepper<KnightProblem>>(problem, beam)));
+    }
+    entries.push_back(make_lockstep_entry("Recocido Simulado (2-opt, Delta O(1))",
+        make_shared<SaStepper<KnightAnnealing, GeometricCooling>>(annealing, GeometricCooling{0.6, 0.99999}, options)));
+    print_lockstep(run_lockstep(entries, quantum, options.max_iterations));
+    print_intern_stats(shared.stats());
+}
+
 int main() {
     // 1. VALORES FIJOS (HARDCODED)
     const int N = 5;         // Tamaño fijo del tablero
@@ -234,6 +582,18 @@ int main() {
     cout << "--- Optimizador de Algoritmos de Búsqueda (Recorrido del Caballo) ---" << endl;
     cout << "CONFIGURACION FIJA: Tablero " << N << "x" << N << " | Inicio (" << startX << "," << startY << ")" << endl;
 
+    // Modo portafolio (SEARCH_PORTFOLIO=1): la primera solución válida gana
+    if (portfolio_mode()) {
+        run_portfolio_knight(N, startX, startY);
+        return 0;
+    }
+
+    // Modo lockstep (SEARCH_LOCKSTEP=<cuanto>): mismo presupuesto de trabajo para todos
+    if (lockstep_quantum() > 0) {
+        run_lockstep_knight(N, startX, startY, lockstep_quantum());
+        return 0;
+    }
+
     vector<Result> results;
     
     // Ejecución de algoritmos
@@ -241,6 +601,11 @@ int main() {
     results.push_back(run_bfs_knight(N, startX, startY));
     results.push_back(run_a_star_knight(N, startX, startY)); 
     results.push_back(run_hill_climbing_knight(N, startX, startY));
+    results.push_back(run_hda_star_knight(N, startX, startY));
+    results.push_back(run_ida_star_knight(N, startX, startY));
+    results.push_back(run_parallel_bfs_knight(N, startX, startY));
+    results.push_back(run_simulated_annealing_knight(N, startX, startY));
+    results.push_back(run_beam_search_knight(N, startX, startY));
 
     // Análisis y Selector de Óptimo
     Result optimal_result = {"", numeric_limits<double>::max(), false};
@@ -262,6 +627,11 @@ int main() {
     }
     cout << "--------------------------------------------------------------------------------" << endl;
 
+    // Detalles adicionales de los motores del núcleo de búsqueda
+    for (const auto& res : results) {
+        if (!res.details.empty()) cout << "   * " << res.name << ": " << res.details << endl;
+    }
+
     if (optimal_result.duration_ms != numeric_limits<double>::max() && optimal_result.found) {
         cout << "\n🏆 ALGORITMO MÁS RÁPIDO PARA N=" << N << ":" << endl;
         cout << "   > Algoritmo: " << optimal_result.name << endl;
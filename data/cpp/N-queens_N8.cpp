@@ -12,6 +12,22 @@
 #include <iomanip>
 #include <random> // Soluciona el error: Añadido para default_random_engine y shuffle
 
+#include "hda_star.h"
+#include "parallel_bfs.h"
+#include "anytime_profile.h"
+#include "simulated_annealing.h"
+#include "portfolio.h"
+#include "stepper.h"
+#include "state_intern.h"
+#include "tabu_search.h"
+#include "nqueens_bitboard.h"
+#include "nqueens_parallel.h"
+#include "nqueens_min_conflicts.h"
+#include "nqueens_tree.h"
+#include "nqueens_constructive.h"
+#include "dancing_links.h"
+#include "nqueens_fixed.h"
+
 using namespace std;
 using namespace std::chrono;
 
@@ -32,6 +48,8 @@ struct Result {
     double duration_ms;
     bool found;
     int solutions_count = 0;
+    string profile = ""; // Curva "ms:objetivo" de las búsquedas local / anytime
+    string details = ""; // Detalles opcionales (soluciones únicas, nodos, ...)
 };
 
 /**
@@ -74,61 +92,109 @@ bool is_goal(const State &s, int N) {
 
 // --- 2. Implementaciones de Algoritmos de Búsqueda ---
 
-// a) Backtracking (BT) - Encontrando todas las soluciones
-int solve_backtracking_util(vector<int>& col_of_row, int row, int N, int& count) {
-    if (row == N) {
-        count++;
-        return 0; // Continúa buscando más soluciones
-    }
-
-    for (int col = 0; col < N; ++col) {
-        if (is_safe(col_of_row, row, col)) {
-            col_of_row.push_back(col);
-            solve_backtracking_util(col_of_row, row + 1, N, count);
-            col_of_row.pop_back(); // BACKTRACK
-        }
-    }
-    return 0;
-}
-
+// a) Backtracking (BT) - Encontrando todas las soluciones con máscaras de bits (nqueens_bitboard.h)
 Result run_backtracking(int N) {
     auto start = high_resolution_clock::now();
-    int count = 0;
-    vector<int> col_of_row;
-    solve_backtracking_util(col_of_row, 0, N, count);
+    BitboardStats stats = nqueens_bitboard_count(N);
     auto end = high_resolution_clock::now();
     
-    return {"Backtracking (Todas las Soluciones)", 
+    return {"Backtracking Bitboard (Todas las Soluciones)", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.solutions > 0, 
+            (int)stats.solutions};
+}
+
+// a2) Backtracking con Simetrías - Media primera fila (reflejo) y formas canónicas bajo las 8 simetrías
+Result run_backtracking_symmetry(int N) {
+    auto start = high_resolution_clock::now();
+    SymmetryStats stats = nqueens_count_symmetric(N);
+    auto end = high_resolution_clock::now();
+
+    ostringstream details;
+    details << stats.unique << " soluciones fundamentales (únicas salvo rotación/reflejo), "
+            << stats.enumerated << " visitadas de " << stats.total << ", " << stats.nodes << " nodos";
+    return {"Backtracking Simetrías (Total y Únicas)", 
             duration_cast<microseconds>(end - start).count() / 1000.0, 
-            count > 0, 
-            count};
+            stats.total > 0, 
+            (int)stats.total,
+            "",
+            details.str()};
 }
 
+// a3) Backtracking Paralelo - Prefijos de filas repartidos entre hilos con robo de trabajo (nqueens_parallel.h)
+Result run_parallel_backtracking(int N) {
+    auto start = high_resolution_clock::now();
+    ParallelCountStats stats = nqueens_count_parallel(N);
+    auto end = high_resolution_clock::now();
 
-// b) DFS - Encontrando la primera solución
-bool solve_dfs_util(vector<int>& col_of_row, int row, int N) {
-    if (row == N) return true; // ¡Solución encontrada!
+    ostringstream details;
+    details << stats.threads << " hilos, " << stats.tasks << " tareas de " << stats.prefix_rows << " filas, "
+            << stats.steals << " robadas, " << stats.nodes << " nodos";
+    return {"Backtracking Paralelo (Robo de Trabajo)", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.solutions > 0, 
+            (int)stats.solutions,
+            "",
+            details.str()};
+}
 
-    for (int col = 0; col < N; ++col) {
-        if (is_safe(col_of_row, row, col)) {
-            col_of_row.push_back(col);
-            if (solve_dfs_util(col_of_row, row + 1, N))
-                return true; // Propagar éxito
-            col_of_row.pop_back(); // BACKTRACK
-        }
+
+// N-Reinas como cobertura exacta: fila por casilla; filas y columnas del tablero primarias, diagonales secundarias
+DancingLinks nqueens_exact_cover(int N) {
+    DancingLinks dlx(2 * N, 2 * (2 * N - 1));
+    for (int r = 0; r < N; ++r) {
+        for (int c = 0; c < N; ++c) dlx.add_row({r, N + c, 2 * N + r + c, 2 * N + (2 * N - 1) + r - c + N - 1});
     }
-    return false;
+    return dlx;
+}
+
+// a4) Dancing Links - Algoritmo X sobre la matriz de cobertura exacta, todas las soluciones (dancing_links.h)
+Result run_dancing_links(int N) {
+    auto start = high_resolution_clock::now();
+    DancingLinks dlx = nqueens_exact_cover(N);
+    DlxOptions options;
+    options.mode = DLX_COUNT_ALL;
+    DlxStats stats = dlx.solve(options);
+    auto end = high_resolution_clock::now();
+
+    ostringstream details;
+    details << dlx.rows() << " filas x " << dlx.columns() << " columnas, " << stats.nodes << " filas probadas, "
+            << stats.updates << " enlaces reescritos";
+    return {"Dancing Links (Cobertura Exacta)", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.found, 
+            (int)stats.solutions,
+            "",
+            details.str()};
 }
 
+// a5) Backtracking con N en Compilación - Instancia template<int N> elegida por tabla (nqueens_fixed.h)
+Result run_fixed_backtracking(int N) {
+    auto start = high_resolution_clock::now();
+    BitboardStats stats = nqueens_count_dispatch(N);
+    auto end = high_resolution_clock::now();
+
+    ostringstream details;
+    details << (nqueens_fixed_available(N) ? "instancia NQueensFixed<" + to_string(N) + ">" : string("ruta genérica (N fuera de 4..16)"))
+            << ", " << stats.nodes << " nodos";
+    return {"Backtracking Plantilla (N Fijo)", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.solutions > 0, 
+            (int)stats.solutions,
+            "",
+            details.str()};
+}
+
+// b) DFS - Encontrando la primera solución con máscaras de bits
 Result run_dfs(int N) {
     auto start = high_resolution_clock::now();
-    vector<int> solution;
-    bool found = solve_dfs_util(solution, 0, N);
+    vector<int> solution; // solution[fila] = columna
+    BitboardStats stats = nqueens_first_dispatch(N, solution); // Instancia de N si existe
     auto end = high_resolution_clock::now();
     
-    return {"DFS (Primera Solución)", 
+    return {"DFS Bitboard (Primera Solución)", 
             duration_cast<microseconds>(end - start).count() / 1000.0, 
-            found};
+            stats.solutions > 0};
 }
 
 // c) BFS - Encontrando la primera solución
@@ -143,16 +209,22 @@ Result run_bfs(int N) {
 
     while (!q.empty()) {
         State current = q.front(); q.pop();
+        int depth = (int)current.queens.size(); // Filas colocadas
+        SEARCH_TRACE(TRACE_EXPAND, trace_hash_value(current.queens), depth, depth, -1);
         
         if (is_goal(current, N)) {
+            SEARCH_TRACE(TRACE_GOAL, trace_hash_value(current.queens), depth, depth, 0);
             found = true;
             break;
         }
         
         for (auto &next : get_neighbors(current, N)) {
             if (visited.find(next) == visited.end()) {
+                SEARCH_TRACE(TRACE_GENERATE, trace_hash_value(next.queens), depth + 1, depth + 1, -1);
                 visited.insert(next);
                 q.push(next);
+            } else {
+                SEARCH_TRACE(TRACE_PRUNE, trace_hash_value(next.queens), depth + 1, depth + 1, -1);
             }
         }
         // Límite de seguridad
@@ -177,6 +249,7 @@ struct AStarState {
 
 Result run_a_star(int N) {
     auto start = high_resolution_clock::now();
+    AnytimeProfile profile; // Mejor objetivo vs. tiempo
     priority_queue<AStarState, vector<AStarState>, greater<AStarState>> pq;
     set<vector<int>> visited_queens; 
     AStarState start_state = {{}, 0, 0};
@@ -186,8 +259,11 @@ Result run_a_star(int N) {
 
     while (!pq.empty()) {
         AStarState current = pq.top(); pq.pop();
+        profile.record(N - (int)current.state.queens.size()); // Filas sin reina
+        SEARCH_TRACE(TRACE_EXPAND, trace_hash_value(current.state.queens), current.cost, current.cost, current.heuristic);
 
         if (is_goal(current.state, N)) {
+            SEARCH_TRACE(TRACE_GOAL, trace_hash_value(current.state.queens), current.cost, current.cost, 0);
             found = true;
             break;
         }
@@ -195,8 +271,11 @@ Result run_a_star(int N) {
         for (auto &next_state : get_neighbors(current.state, N)) {
             if (visited_queens.find(next_state.queens) == visited_queens.end()) {
                 AStarState next_astar = {next_state, current.cost + 1, 0};
+                SEARCH_TRACE(TRACE_GENERATE, trace_hash_value(next_state.queens), current.cost + 1, current.cost + 1, 0);
                 visited_queens.insert(next_state.queens);
                 pq.push(next_astar);
+            } else {
+                SEARCH_TRACE(TRACE_PRUNE, trace_hash_value(next_state.queens), current.cost + 1, current.cost + 1, -1);
             }
         }
         // Límite de seguridad
@@ -204,9 +283,43 @@ Result run_a_star(int N) {
     }
 
     auto end = high_resolution_clock::now();
-    return {"A* (Heurística h=0)", 
+    Result result = {"A* (Heurística h=0)", 
             duration_cast<microseconds>(end - start).count() / 1000.0, 
             found};
+    result.profile = profile.to_string();
+    return result;
+}
+
+// c2) BFS en Árbol - Sin conjunto de visitados, frontera por niveles empaquetada en bytes (nqueens_tree.h)
+Result run_tree_bfs(int N) {
+    auto start = high_resolution_clock::now();
+    TreeSearchStats stats = nqueens_tree_bfs(N);
+    auto end = high_resolution_clock::now();
+
+    ostringstream details;
+    details << stats.expanded << " expandidos, frontera máxima " << stats.peak_nodes << " nodos ("
+            << stats.peak_bytes / 1024 << " KB)" << (stats.truncated ? ", cortado por memoria" : "");
+    Result result = {"BFS Árbol (Sin Visitados)", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.found};
+    result.details = details.str();
+    return result;
+}
+
+// d2) A* en Árbol - Sin conjunto cerrado, h = filas restantes con poda hacia adelante
+Result run_tree_a_star(int N) {
+    auto start = high_resolution_clock::now();
+    TreeSearchStats stats = nqueens_tree_astar(N);
+    auto end = high_resolution_clock::now();
+
+    ostringstream details;
+    details << stats.expanded << " expandidos, " << stats.pruned << " hijos podados, cola máxima "
+            << stats.peak_nodes << " nodos" << (stats.truncated ? ", cortado por el límite" : "");
+    Result result = {"A* Árbol (Sin Visitados)", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.found};
+    result.details = details.str();
+    return result;
 }
 
 // e) Hill Climbing (HC) - Encontrando una solución
@@ -226,6 +339,7 @@ int count_conflicts(const vector<int>& col_of_row) {
 
 Result run_hill_climbing(int N) {
     auto start = high_resolution_clock::now();
+    AnytimeProfile profile; // Mejor objetivo vs. tiempo
     vector<int> current_queens(N);
     bool found = false;
 
@@ -241,6 +355,7 @@ Result run_hill_climbing(int N) {
 
 
     int current_conflicts = count_conflicts(current_queens);
+    profile.record(current_conflicts);
     int iterations = 0;
     const int MAX_ITERATIONS = 10000; 
 
@@ -270,6 +385,7 @@ Result run_hill_climbing(int N) {
         if (improvement) {
             current_queens = best_queens;
             current_conflicts = best_conflicts;
+            profile.record(current_conflicts);
         } else {
             // Máximo local: se detiene.
             break;
@@ -281,12 +397,473 @@ Result run_hill_climbing(int N) {
     }
 
     auto end = high_resolution_clock::now();
-    return {"Hill Climbing (Búsqueda Local)", 
+    Result result = {"Hill Climbing (Búsqueda Local)", 
             duration_cast<microseconds>(end - start).count() / 1000.0, 
             found};
+    result.profile = profile.to_string();
+    return result;
 }
 
 
+// e2) Min-Conflicts - Contadores por columna y diagonal, inicialización voraz (nqueens_min_conflicts.h)
+Result run_min_conflicts(int N) {
+    auto start = high_resolution_clock::now();
+    AnytimeProfile profile; // Mejor objetivo vs. tiempo
+    vector<int> columns;
+    MinConflictsOptions options;
+    options.seed = std::chrono::system_clock::now().time_since_epoch().count();
+    MinConflictsStats stats = nqueens_min_conflicts(N, columns, options, &profile);
+    auto end = high_resolution_clock::now();
+
+    ostringstream details;
+    details << stats.initial_conflicts << " conflictos tras la inicialización voraz, " << stats.steps << " movimientos, "
+            << "filas evaluadas con " << simd_level_name(simd_level());
+    Result result = {"Min-Conflicts (Contadores O(1))", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.found};
+    result.profile = profile.to_string();
+    result.details = details.str();
+    return result;
+}
+
+
+// --- Adaptador para el núcleo de búsqueda genérico (search_core.h) ---
+
+/**
+ * @brief N-Queens con estado empaquetado: 4 bits por fila con la columna de la reina (N <= 16).
+ */
+struct NQueensProblem {
+    struct State {
+        uint64_t cols; // Columna de la reina de cada fila ya colocada
+        int row;       // Número de filas colocadas
+        bool operator==(const State &other) const { return cols == other.cols && row == other.row; }
+    };
+    int N;
+
+    State initial() const { return {0, 0}; }
+    bool is_goal(const State &s) const { return s.row == N; }
+    int heuristic(const State &s) const { return N - s.row; } // Reinas restantes
+    uint64_t hash(const State &s) const { return s.cols * 31 + s.row; }
+    // Parámetros de la instancia para la huella de los checkpoints (checkpoint.h).
+    uint64_t fingerprint() const { return checkpoint_hash({(uint64_t)N}); }
+    int col_of(const State &s, int r) const { return (int)((s.cols >> (4 * r)) & 15); }
+
+    template <class Visit>
+    void expand(const State &s, Visit &&visit) const {
+        for (int col = 0; col < N; col++) {
+            bool safe = true;
+            for (int i = 0; i < s.row && safe; i++) {
+                int qcol = col_of(s, i);
+                if (qcol == col || abs(qcol - col) == abs(i - s.row)) safe = false;
+            }
+            if (safe) visit(State{s.cols | ((uint64_t)col << (4 * s.row)), s.row + 1}, 1);
+        }
+    }
+};
+
+// e3) Construcción Explícita - Columna de cada fila en O(1) según N mod 6, sin búsqueda (nqueens_constructive.h)
+Result run_constructive(int N) {
+    auto start = high_resolution_clock::now();
+    NQueensVerifier verifier(N); // Comprueba la construcción en la misma pasada
+    bool built = nqueens_constructive(N, verifier);
+    auto end = high_resolution_clock::now();
+
+    ostringstream details;
+    details << (built ? "patrón pares/impares (N mod 6 = " + to_string(N % 6) + ")" : "sin solución para N = 2, 3")
+            << ", verificador de " << verifier.bytes() << " bytes";
+    Result result = {"Construcción Explícita (O(N))", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            built && verifier.valid()};
+    result.details = details.str();
+    return result;
+}
+
+// f) HDA* - A* paralelo distribuido por hash (usa todos los núcleos)
+Result run_hda_star(int N) {
+    auto start = high_resolution_clock::now();
+    if (N > 16) return {"HDA* (Inviable para N > 16)", 0.0, false};
+
+    NQueensProblem problem{N};
+    SearchStats stats = hda_star(problem, 0, 500000);
+
+    auto end = high_resolution_clock::now();
+    return {"HDA* (A* Paralelo)", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.found};
+}
+
+// g) BFS Paralelo - Síncrono por niveles con frontera empaquetada
+Result run_parallel_bfs(int N) {
+    auto start = high_resolution_clock::now();
+    if (N > 16) return {"BFS Paralelo (Inviable para N > 16)", 0.0, false};
+
+    NQueensProblem problem{N};
+    ParallelBfsStats stats = parallel_bfs(problem, 0, 500000);
+
+    auto end = high_resolution_clock::now();
+    return {"BFS Paralelo (Por Niveles)", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.found};
+}
+
+// --- Adaptador para el recocido simulado (simulated_annealing.h) ---
+
+/**
+ * @brief Reinas como permutación (una por fila y por columna): solo chocan en diagonales.
+ *
+ * Un movimiento intercambia las columnas de dos filas. Con contadores por
+ * diagonal, el cambio de conflictos de un intercambio se calcula en O(1).
+ */
+class NQueensAnnealing {
+public:
+    struct Move {
+        int a, b; // Filas cuyas columnas se intercambian
+    };
+
+    NQueensAnnealing(int N, SaRng &rng) : N(N), cols(N), diag_sum(2 * N - 1, 0), diag_diff(2 * N - 1, 0) {
+        for (int i = 0; i < N; ++i) cols[i] = i;
+        for (int i = N - 1; i > 0; --i) swap(cols[i], cols[rng.below(i + 1)]);
+        for (int r = 0; r < N; ++r) {
+            conflicts += diag_sum[r + cols[r]]++;
+            conflicts += diag_diff[r - cols[r] + N - 1]++;
+        }
+    }
+
+    long long cost() const { return conflicts; }
+
+    // Se prefiere mover una reina atacada (unos pocos intentos, O(1)); el compañero es aleatorio.
+    Move propose(SaRng &rng) const {
+        int a = rng.below(N);
+        for (int tries = 0; tries < 8 && !attacked(a); ++tries) a = rng.below(N);
+        int b = rng.below(N - 1);
+        return {a, b >= a ? b + 1 : b};
+    }
+
+    long long delta(const Move &m) const {
+        int ca = cols[m.a], cb = cols[m.b];
+        return diag_delta(diag_sum, m.a + ca, m.b + cb, m.a + cb, m.b + ca) +
+               diag_delta(diag_diff, m.a - ca + N - 1, m.b - cb + N - 1, m.a - cb + N - 1, m.b - ca + N - 1);
+    }
+
+    void apply(const Move &m) {
+        conflicts += delta(m);
+        for (int r : {m.a, m.b}) {
+            diag_sum[r + cols[r]]--;
+            diag_diff[r - cols[r] + N - 1]--;
+        }
+        swap(cols[m.a], cols[m.b]);
+        for (int r : {m.a, m.b}) {
+            diag_sum[r + cols[r]]++;
+            diag_diff[r - cols[r] + N - 1]++;
+        }
+    }
+
+private:
+    bool attacked(int r) const { return diag_sum[r + cols[r]] > 1 || diag_diff[r - cols[r] + N - 1] > 1; }
+
+    // Cambio de pares en conflicto al quitar reinas de x1, x2 y ponerlas en y1, y2 (pueden coincidir).
+    static long long diag_delta(const vector<int> &count, int x1, int x2, int y1, int y2) {
+        const int idx[4] = {x1, x2, y1, y2};
+        const int change[4] = {-1, -1, +1, +1};
+        long long d = 0;
+        for (int i = 0; i < 4; ++i) {
+            int k = count[idx[i]];
+            for (int j = 0; j < i; ++j) {
+                if (idx[j] == idx[i]) k += change[j];
+            }
+            d += change[i] < 0 ? -(k - 1) : k;
+        }
+        return d;
+    }
+
+    int N;
+    vector<int> cols;       // Columna de la reina de cada fila
+    vector<int> diag_sum;   // Reinas por diagonal r + c
+    vector<int> diag_diff;  // Reinas por diagonal r - c + N - 1
+    long long conflicts = 0;
+};
+
+// h) Recocido Simulado - Búsqueda local que escapa de óptimos locales
+Result run_simulated_annealing(int N) {
+    auto start = high_resolution_clock::now();
+    AnytimeProfile profile; // Mejor objetivo vs. tiempo
+    SaRng rng(std::chrono::system_clock::now().time_since_epoch().count());
+
+    NQueensAnnealing problem(N, rng);
+    SaOptions options;
+    options.max_iterations = max(2000000LL, 500LL * N);
+    options.reheat_after = max(20000LL, 50LL * N);
+    options.seed = rng.next();
+    SaStats stats = simulated_annealing(problem, GeometricCooling{1.0, 0.9995}, options, &profile);
+
+    auto end = high_resolution_clock::now();
+    Result result = {"Recocido Simulado (Delta O(1))", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.found};
+    result.profile = profile.to_string();
+    return result;
+}
+
+// --- Adaptador para la búsqueda tabú (tabu_search.h) ---
+
+/**
+ * @brief Reinas con una por fila y columna libre: variable = fila, valor = columna.
+ *
+ * Por cada columna y diagonal se guarda cuántas reinas tiene y la suma de sus
+ * filas. Así delta() es O(1) y, al mover una reina, las únicas filas que pueden
+ * entrar o salir del conjunto en conflicto son las que compartían una línea con
+ * ella: cuando una línea queda con 1 reina (o pasa a tener 2) la suma de filas
+ * identifica a la otra sin recorrer el tablero.
+ */
+class NQueensTabu {
+public:
+    NQueensTabu(int N, SaRng &rng) : N(N), cols(N), slot(N, -1) {
+        for (int k = 0; k < 3; ++k) {
+            line_count[k].assign(k == 0 ? N : 2 * N - 1, 0);
+            line_rows[k].assign(k == 0 ? N : 2 * N - 1, 0);
+        }
+        // Permutación aleatoria: sin conflictos de columna al empezar.
+        for (int i = 0; i < N; ++i) cols[i] = i;
+        for (int i = N - 1; i > 0; --i) swap(cols[i], cols[rng.below(i + 1)]);
+        for (int r = 0; r < N; ++r) place(r);
+        for (int r = 0; r < N; ++r) refresh(r);
+    }
+
+    long long cost() const { return conflicts; }
+    int variables() const { return N; }
+    int values() const { return N; }
+    int value(int r) const { return cols[r]; }
+    int conflicted_count() const { return (int)attacked.size(); }
+    int conflicted(int i) const { return attacked[i]; }
+
+    long long delta(int r, int c) const {
+        int cur = cols[r];
+        if (c == cur) return 0;
+        int before = line_count[0][cur] + line_count[1][r + cur] + line_count[2][r - cur + N - 1] - 3;
+        int after = line_count[0][c] + line_count[1][r + c] + line_count[2][r - c + N - 1];
+        return after - before;
+    }
+
+    void assign(int r, int c) {
+        lift(r);
+        cols[r] = c;
+        place(r);
+        refresh(r);
+    }
+
+private:
+    int line(int k, int r) const { return k == 0 ? cols[r] : (k == 1 ? r + cols[r] : r - cols[r] + N - 1); }
+
+    void lift(int r) {
+        for (int k = 0; k < 3; ++k) {
+            int l = line(k, r);
+            conflicts -= --line_count[k][l];
+            line_rows[k][l] -= r;
+            if (line_count[k][l] == 1) refresh((int)line_rows[k][l]); // La reina que queda puede dejar de estar atacada
+        }
+    }
+
+    void place(int r) {
+        for (int k = 0; k < 3; ++k) {
+            int l = line(k, r);
+            conflicts += line_count[k][l]++;
+            if (line_count[k][l] == 2) {
+                int other = (int)line_rows[k][l]; // La que estaba sola pasa a estar atacada
+                line_rows[k][l] += r;
+                refresh(other);
+            } else {
+                line_rows[k][l] += r;
+            }
+        }
+    }
+
+    // Mantiene r dentro o fuera del conjunto de filas en conflicto.
+    void refresh(int r) {
+        bool hit = line_count[0][cols[r]] > 1 || line_count[1][r + cols[r]] > 1 || line_count[2][r - cols[r] + N - 1] > 1;
+        if (hit && slot[r] < 0) {
+            slot[r] = (int)attacked.size();
+            attacked.push_back(r);
+        } else if (!hit && slot[r] >= 0) {
+            int last = attacked.back();
+            attacked[slot[r]] = last;
+            slot[last] = slot[r];
+            attacked.pop_back();
+            slot[r] = -1;
+        }
+    }
+
+    int N;
+    vector<int> cols;                // Columna de la reina de cada fila
+    vector<int> line_count[3];       // Reinas por columna, diagonal r + c y diagonal r - c + N - 1
+    vector<long long> line_rows[3];  // Suma de las filas de esas reinas
+    vector<int> attacked;            // Filas atacadas
+    vector<int> slot;                // Posición de cada fila en "attacked" (-1 = fuera)
+    long long conflicts = 0;         // Pares de reinas que se atacan
+};
+
+// i) Búsqueda Tabú - Mejor movimiento no tabú con aspiración y evaluación O(1)
+Result run_tabu_search(int N) {
+    auto start = high_resolution_clock::now();
+    AnytimeProfile profile; // Mejor objetivo vs. tiempo
+    SaRng rng(std::chrono::system_clock::now().time_since_epoch().count());
+
+    NQueensTabu problem(N, rng);
+    TabuOptions options;
+    options.max_iterations = max(100000LL, 20LL * N);
+    options.sampled_variables = 4; // Pocas filas atacadas por iteración: O(4N) evaluaciones
+    options.tenure = TabuTenure{2, 5, 0.1};
+    options.seed = rng.next();
+    TabuStats stats = tabu_search(problem, options, &profile);
+
+    auto end = high_resolution_clock::now();
+    Result result = {"Búsqueda Tabú (Aspiración)", 
+            duration_cast<microseconds>(end - start).count() / 1000.0, 
+            stats.found};
+    result.profile = profile.to_string();
+    return result;
+}
+
+
+// --- Modo portafolio (portfolio.h): la primera solución gana y cancela al resto ---
+
+/**
+ * @brief Corre en paralelo los algoritmos cancelables e imprime el primero que resuelve.
+ */
+void run_portfolio_nqueens(int N) {
+    int threads = portfolio_threads_per_entry(6);
+    vector<PortfolioEntry> entries;
+    if (N <= 16) {
+        entries.push_back({"HDA* (A* Paralelo)", [&](const StopToken &token) {
+            CancellableProblem<NQueensProblem> problem(NQueensProblem{N}, token);
+            SearchStats stats = hda_star(problem, threads, 500000);
+            return PortfolioOutcome{stats.found, stats.expanded};
+        }});
+        entries.push_back({"BFS Paralelo (Por Niveles)", [&](const StopToken &token) {
+            CancellableProblem<NQueensProblem> problem(NQueensProblem{N}, token);
+            ParallelBfsStats stats = parallel_bfs(problem, threads, 500000, CheckpointConfig());
+            return PortfolioOutcome{stats.found, stats.expanded};
+        }});
+    }
+    entries.push_back({"Recocido Simulado (Delta O(1))", [&](const StopToken &token) {
+        SaRng rng(std::chrono::system_clock::now().time_since_epoch().count());
+        NQueensAnnealing problem(N, rng);
+        SaOptions options;
+        options.max_iterations = max(2000000LL, 500LL * N);
+        options.reheat_after = max(20000LL, 50LL * N);
+        options.seed = rng.next();
+        options.stop = token.flag();
+        SaStats stats = simulated_annealing(problem, GeometricCooling{1.0, 0.9995}, options);
+        return PortfolioOutcome{stats.found, stats.iterations};
+    }});
+    entries.push_back({"Búsqueda Tabú (Aspiración)", [&](const StopToken &token) {
+        SaRng rng(std::chrono::system_clock::now().time_since_epoch().count());
+        NQueensTabu problem(N, rng);
+        TabuOptions options;
+        options.max_iterations = max(100000LL, 20LL * N);
+        options.sampled_variables = 4;
+        options.tenure = TabuTenure{2, 5, 0.1};
+        options.seed = rng.next();
+        options.stop = token.flag();
+        TabuStats stats = tabu_search(problem, options);
+        return PortfolioOutcome{stats.found, stats.iterations};
+    }});
+    entries.push_back({"Min-Conflicts (Contadores O(1))", [&](const StopToken &token) {
+        vector<int> columns;
+        MinConflictsOptions options;
+        options.seed = std::chrono::system_clock::now().time_since_epoch().count();
+        options.stop = token.flag();
+        MinConflictsStats stats = nqueens_min_conflicts(N, columns, options);
+        return PortfolioOutcome{stats.found, stats.steps};
+    }});
+    entries.push_back({"Dancing Links (Fila al Azar)", [&](const StopToken &token) {
+        DancingLinks dlx = nqueens_exact_cover(N);
+        DlxOptions options;
+        options.mode = DLX_RANDOM;
+        options.seed = std::chrono::system_clock::now().time_since_epoch().count();
+        options.stop = token.flag();
+        DlxStats stats = dlx.solve(options);
+        return PortfolioOutcome{stats.found, stats.nodes};
+    }});
+    print_portfolio(run_portfolio(entries));
+}
+
+// Modo lockstep: todos los motores avanzan por turnos en un hilo con el mismo cuanto
+void run_lockstep_nqueens(int N, long long quantum) {
+    NQueensProblem problem{N};
+    InternedProblem<NQueensProblem> shared(problem); // A* y BFS comparten estados, h y sucesores
+    SaRng rng(std::chrono::system_clock::now().time_since_epoch().count());
+    NQueensAnnealing annealing(N, rng);
+    SaOptions options;
+    options.max_iterations = max(2000000LL, 500LL * N);
+    options.reheat_after = max(20000LL, 50LL * N);
+    options.seed = rng.next();
+    NQueensTabu tabu_problem(N, rng);
+    TabuOptions tabu;
+    tabu.max_iterations = max(100000LL, 20LL * N);
+    tabu.sampled_variables = 4;
+    tabu.tenure = TabuTenure{2, 5, 0.1};
+    tabu.seed = rng.next();
+
+    vector<LockstepEntry> entries;
+    if (N <= 16) {
+        entries.push_back(make_lockstep_entry("A* (Por Pasos)", make_shared<AStarStepper<InternedProblem<NQueensProblem>>>(shared)));
+        entries.push_back(make_lockstep_entry("BFS (Por Pasos)", make_shared<BfsStepper<InternedProblem<NQueensProblem>>>(shared)));
+    }
+    entries.push_back(make_lockstep_entry("Recocido Simulado (Delta O(1))",
+        make_shared<SaStepper<NQueensAnnealing, GeometricCooling>>(annealing, GeometricCooling{1.0, 0.9995}, options)));
+    entries.push_back(make_lockstep_entry("Búsqueda Tabú (Aspiración)", make_shared<TabuStepper<NQueensTabu>>(tabu_problem, tabu)));
+    print_lockstep(run_lockstep(entries, quantum, options.max_iterations));
+    print_intern_stats(shared.stats());
+}
+
+// Modo constructivo: emite la solución explícita fila a fila (a SEARCH_CONSTRUCT_FILE si está definido)
+// y la verifica en la misma pasada, sin guardar el tablero
+void run_constructive_stream(long long n) {
+    const char *path = std::getenv("SEARCH_CONSTRUCT_FILE");
+    FILE *out = path != nullptr ? std::fopen(path, "wb") : nullptr;
+    if (path != nullptr && out == nullptr) {
+        cout << "No se pudo abrir " << path << endl;
+        return;
+    }
+    auto start = high_resolution_clock::now();
+    NQueensVerifier verifier(n);
+    NQueensColumnWriter writer(out != nullptr ? out : stdout);
+    bool built = nqueens_constructive(n, [&](long long row, long long col) {
+        verifier(row, col);
+        if (out != nullptr) writer(row, col);
+    });
+    writer.flush();
+    auto end = high_resolution_clock::now();
+    if (out != nullptr) std::fclose(out);
+
+    cout << fixed << setprecision(4) << "\n--- Construcción Explícita (N=" << n << ") ---" << endl;
+    cout << "   * Solución: " << (built ? (verifier.valid() ? "válida" : "INVÁLIDA") : "no existe (N = 2, 3)") << endl;
+    cout << "   * Tiempo: " << duration_cast<microseconds>(end - start).count() / 1000.0 << " ms" << endl;
+    cout << "   * Verificador: " << verifier.bytes() / (1024.0 * 1024.0) << " MB" << endl;
+    if (out != nullptr) cout << "   * Escritos " << writer.bytes() << " bytes en " << path << endl;
+}
+
+// Modo min-conflicts: resuelve N grande (p. ej. 10^6) y verifica la solución con NQueensVerifier
+void run_min_conflicts_large(int n) {
+    MinConflictsOptions options;
+    options.seed = std::chrono::system_clock::now().time_since_epoch().count();
+    vector<int> columns;
+    auto start = high_resolution_clock::now();
+    MinConflictsStats stats = nqueens_min_conflicts(n, columns, options);
+    auto solved = high_resolution_clock::now();
+    NQueensVerifier verifier(n);
+    for (int row = 0; row < n; ++row) verifier(row, columns[row]);
+    auto end = high_resolution_clock::now();
+
+    cout << fixed << setprecision(4) << "\n--- Min-Conflicts (N=" << n << ") ---" << endl;
+    cout << "   * Solución: " << (stats.found ? (verifier.valid() ? "válida" : "INVÁLIDA") : "no encontrada")
+         << " (" << stats.final_conflicts << " pares atacados al final)" << endl;
+    cout << "   * Tiempo: " << duration_cast<microseconds>(solved - start).count() / 1000.0 << " ms, verificación "
+         << duration_cast<microseconds>(end - solved).count() / 1000.0 << " ms" << endl;
+    cout << "   * Movimientos: " << stats.steps << ", conflictos tras la inicialización voraz: " << stats.initial_conflicts
+         << ", filas evaluadas con " << simd_level_name(simd_level()) << endl;
+}
+
 // --- 3. Bloque Principal de Ejecución y Selector de Óptimo ---
 
 int main() {
@@ -297,15 +874,51 @@ int main() {
     cout << "--- Optimizador de Algoritmos de Búsqueda (N-Queens) ---" << endl;
     cout << "Tablero fijo: N=" << N << endl;
 
+    // Modo portafolio (SEARCH_PORTFOLIO=1): la primera solución válida gana
+    if (portfolio_mode()) {
+        run_portfolio_nqueens(N);
+        return 0;
+    }
+
+    // Modo lockstep (SEARCH_LOCKSTEP=<cuanto>): mismo presupuesto de trabajo para todos
+    if (lockstep_quantum() > 0) {
+        run_lockstep_nqueens(N, lockstep_quantum());
+        return 0;
+    }
+
+    // Modo constructivo (SEARCH_CONSTRUCT_N=<N>): solución explícita en O(N) para N muy grande
+    if (construct_mode_n() > 0) {
+        run_constructive_stream(construct_mode_n());
+        return 0;
+    }
+
+    // Modo min-conflicts (SEARCH_MINCONFLICTS_N=<N>): búsqueda local con contadores O(1) para N grande
+    if (minconflicts_mode_n() > 0) {
+        run_min_conflicts_large(minconflicts_mode_n());
+        return 0;
+    }
+
     // Lista de resultados para la comparación
     vector<Result> results;
     
     // 2. Ejecución y medición de todos los algoritmos
     results.push_back(run_backtracking(N)); 
+    results.push_back(run_backtracking_symmetry(N));
+    results.push_back(run_parallel_backtracking(N));
+    results.push_back(run_dancing_links(N));
+    results.push_back(run_fixed_backtracking(N));
     results.push_back(run_dfs(N));
     results.push_back(run_bfs(N));
     results.push_back(run_a_star(N)); 
+    results.push_back(run_tree_bfs(N));
+    results.push_back(run_tree_a_star(N));
     results.push_back(run_hill_climbing(N));
+    results.push_back(run_min_conflicts(N));
+    results.push_back(run_constructive(N));
+    results.push_back(run_hda_star(N));
+    results.push_back(run_parallel_bfs(N));
+    results.push_back(run_simulated_annealing(N));
+    results.push_back(run_tabu_search(N));
 
     // --- 3. Análisis y Selector de Óptimo ---
 
@@ -330,6 +943,16 @@ int main() {
     }
     cout << "-------------------------------------------------------------------" << endl;
 
+    // Detalles adicionales (conteos, memoria, movimientos)
+    for (const auto& res : results) {
+        if (!res.details.empty()) cout << "   * " << res.name << ": " << res.details << endl;
+    }
+
+    // Curvas calidad vs. tiempo (búsqueda local / anytime)
+    for (const auto& res : results) {
+        if (!res.profile.empty()) cout << "   ~ " << res.name << ": " << res.profile << endl;
+    }
+
     // Mostrar el algoritmo óptimo
     if (optimal_result.duration_ms != numeric_limits<double>::max()) {
         cout << "\n🏆 ALGORITMO MÁS RÁPIDO PARA N=" << N << ":" << endl;
@@ -0,0 +1,74 @@
+// --- Perfil "calidad vs. tiempo" para búsquedas locales y anytime ---
+//
+// Guarda la curva del mejor objetivo (conflictos, h, filas restantes, ...)
+// contra el tiempo transcurrido. Solo se lee el reloj cuando el objetivo
+// mejora, así que registrar cada iteración cuesta una comparación. Como el
+// mejor valor es estrictamente decreciente, la curva tiene a lo sumo tantos
+// puntos como el objetivo inicial.
+//
+// Permite comparar algoritmos por tiempo-hasta-calidad (time_to_target) y no
+// solo por tiempo-hasta-solución.
+
+#ifndef ANYTIME_PROFILE_H
+#define ANYTIME_PROFILE_H
+
+#include <chrono>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <iomanip>
+
+struct AnytimePoint {
+    double elapsed_ms;   // Tiempo desde el inicio del perfil
+    long long objective; // Mejor objetivo alcanzado hasta ese momento (menor es mejor)
+};
+
+class AnytimeProfile {
+public:
+    using Clock = std::chrono::high_resolution_clock;
+
+    AnytimeProfile() : start_(Clock::now()) {}
+
+    // Registra el objetivo actual; solo añade un punto si mejora el mejor valor.
+    void record(long long objective) {
+        if (objective >= best_) return;
+        best_ = objective;
+        double ms = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start_).count() / 1000.0;
+        points_.push_back({ms, objective});
+    }
+
+    long long best() const { return best_; }
+    const std::vector<AnytimePoint> &points() const { return points_; }
+
+    // Tiempo hasta alcanzar un objetivo <= target (-1 si nunca se alcanzó).
+    double time_to_target(long long target) const {
+        for (const AnytimePoint &p : points_) {
+            if (p.objective <= target) return p.elapsed_ms;
+        }
+        return -1.0;
+    }
+
+    /**
+     * @brief Curva compacta "t:objetivo" (ms). Con muchos puntos se muestran los extremos.
+     */
+    std::string to_string(size_t max_points = 12) const {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(3);
+        for (size_t i = 0; i < points_.size(); ++i) {
+            if (points_.size() > max_points && i == max_points / 2) {
+                out << " ...";
+                i = points_.size() - max_points / 2;
+            }
+            out << (i == 0 ? "" : " ") << points_[i].elapsed_ms << "ms:" << points_[i].objective;
+        }
+        return out.str();
+    }
+
+private:
+    Clock::time_point start_;
+    long long best_ = std::numeric_limits<long long>::max();
+    std::vector<AnytimePoint> points_;
+};
+
+#endif // ANYTIME_PROFILE_H
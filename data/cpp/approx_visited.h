@@ -0,0 +1,159 @@
+// --- Visitados aproximados: filtro de Bloom por bloques y BFS por niveles ---
+//
+// En un BFS grande lo primero que se queda sin memoria es el conjunto exacto de
+// visitados (StateTable guarda cada estado más su hueco libre). Aquí se cambia
+// por un filtro de Bloom: unos pocos bits por estado según la tasa de falsos
+// positivos pedida. Cada estado toca un solo bloque de 64 bytes (una línea de
+// caché), así que una consulta cuesta un fallo de caché como mucho.
+//
+// Precio: un falso positivo hace creer que un estado nuevo ya se vio y se
+// descarta. La completitud pasa a ser probabilística: una solución encontrada
+// es válida, pero puede no ser la más corta, y "sin solución" solo es cierto
+// con cierta probabilidad. ApproxBfsStats informa la tasa estimada.
+
+#ifndef APPROX_VISITED_H
+#define APPROX_VISITED_H
+
+#include "search_core.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+/**
+ * @brief Filtro de Bloom con bloques de 512 bits: las k sondas de un elemento caen en el mismo bloque.
+ */
+class BlockedBloomFilter {
+public:
+    /**
+     * @param expected_items Elementos previstos (dimensiona el filtro).
+     * @param false_positive_rate Tasa de falsos positivos objetivo con expected_items dentro.
+     */
+    BlockedBloomFilter(size_t expected_items, double false_positive_rate) {
+        expected_items = std::max<size_t>(1, expected_items);
+        false_positive_rate = std::min(0.5, std::max(1e-9, false_positive_rate));
+        // m/n = -ln(p) / ln(2)^2 y k = (m/n) ln 2; +10% de bits compensa el reparto desigual entre bloques.
+        double bits_per_item = -std::log(false_positive_rate) / (std::log(2.0) * std::log(2.0)) * 1.1;
+        probes_ = std::max(1, std::min(16, (int)std::lround(bits_per_item / 1.1 * std::log(2.0))));
+        size_t blocks = (size_t)std::ceil(bits_per_item * expected_items / BLOCK_BITS);
+        blocks_ = 1;
+        while (blocks_ < blocks) blocks_ <<= 1;
+        words_.assign(blocks_ * WORDS_PER_BLOCK, 0);
+    }
+
+    // Inserta un hash (ya mezclado). Devuelve true si el elemento era nuevo (con falsos positivos: false).
+    bool insert(uint64_t hash) {
+        uint64_t *block = &words_[(size_t)(hash & (blocks_ - 1)) * WORDS_PER_BLOCK];
+        // Bloque con los bits bajos; dentro, doble hashing: sonda i = h1 + i * h2 (mod 512).
+        uint32_t h1 = (uint32_t)(hash >> 32), h2 = (uint32_t)mix_hash(hash) | 1;
+        bool added = false;
+        for (int i = 0; i < probes_; ++i) {
+            uint32_t bit = (h1 + i * h2) & (BLOCK_BITS - 1);
+            uint64_t mask = 1ULL << (bit & 63);
+            added |= (block[bit >> 6] & mask) == 0;
+            block[bit >> 6] |= mask;
+        }
+        if (added) items_++;
+        return added;
+    }
+
+    bool contains(uint64_t hash) const {
+        const uint64_t *block = &words_[(size_t)(hash & (blocks_ - 1)) * WORDS_PER_BLOCK];
+        uint32_t h1 = (uint32_t)(hash >> 32), h2 = (uint32_t)mix_hash(hash) | 1;
+        for (int i = 0; i < probes_; ++i) {
+            uint32_t bit = (h1 + i * h2) & (BLOCK_BITS - 1);
+            if ((block[bit >> 6] & (1ULL << (bit & 63))) == 0) return false;
+        }
+        return true;
+    }
+
+    size_t items() const { return items_; }
+    size_t bytes() const { return words_.size() * sizeof(uint64_t); }
+    int probes() const { return probes_; }
+
+    // Tasa de falsos positivos estimada con la ocupación actual: (1 - e^(-k n / m))^k.
+    double estimated_false_positive_rate() const {
+        double fill = 1.0 - std::exp(-(double)probes_ * items_ / ((double)blocks_ * BLOCK_BITS));
+        return std::pow(fill, probes_);
+    }
+
+private:
+    static const uint32_t BLOCK_BITS = 512;
+    static const size_t WORDS_PER_BLOCK = BLOCK_BITS / 64;
+
+    std::vector<uint64_t> words_;
+    size_t blocks_;
+    int probes_;
+    size_t items_ = 0;
+};
+
+struct ApproxBfsStats : SearchStats {
+    int levels = 0;                 // Niveles completados
+    long long visited = 0;          // Estados aceptados como nuevos
+    size_t peak_frontier = 0;       // Mayor frontera (en estados)
+    size_t filter_bytes = 0;        // Memoria del filtro
+    double false_positive_rate = 0; // Tasa estimada al terminar (estados nuevos descartados por error)
+};
+
+/**
+ * @brief BFS por niveles que deduplica con un filtro de Bloom en lugar de un conjunto exacto.
+ *
+ * Solo se guardan la frontera actual y la siguiente; la memoria de visitados es
+ * la del filtro. Completitud probabilística (ver cabecera).
+ * @param max_states Estados previstos y límite de la búsqueda (dimensiona el filtro).
+ * @param false_positive_rate Tasa de falsos positivos objetivo del filtro lleno.
+ */
+template <class P>
+ApproxBfsStats approx_bfs(const P &problem, long long max_states = 5000000, double false_positive_rate = 1e-3) {
+    using State = typename P::State;
+    ProblemHasher<P> hasher{&problem};
+    BlockedBloomFilter seen((size_t)max_states, false_positive_rate);
+    ApproxBfsStats stats;
+    stats.filter_bytes = seen.bytes();
+
+    std::vector<State> frontier, next_frontier;
+    State start = problem.initial();
+    seen.insert(hasher(start));
+    frontier.push_back(start);
+    if (problem.is_goal(start)) {
+        stats.found = true;
+        stats.cost = 0;
+    }
+
+    while (!stats.found && !frontier.empty()) {
+        next_frontier.clear();
+        for (const State &s : frontier) {
+            stats.expanded++;
+            SEARCH_TRACE(TRACE_EXPAND, hasher(s), stats.levels, stats.levels, -1);
+            problem.expand(s, [&](const State &next, int) {
+                stats.generated++;
+                if (stats.found || !seen.insert(hasher(next))) {
+                    SEARCH_TRACE(TRACE_PRUNE, hasher(next), stats.levels + 1, stats.levels + 1, -1);
+                    return;
+                }
+                SEARCH_TRACE(TRACE_GENERATE, hasher(next), stats.levels + 1, stats.levels + 1, -1);
+                if (problem.is_goal(next)) {
+                    SEARCH_TRACE(TRACE_GOAL, hasher(next), stats.levels + 1, stats.levels + 1, 0);
+                    stats.found = true;
+                }
+                next_frontier.push_back(next);
+            });
+            if (stats.found) break;
+        }
+        frontier.swap(next_frontier);
+        stats.levels++;
+        stats.peak_frontier = std::max(stats.peak_frontier, frontier.size());
+        if (stats.found) {
+            stats.cost = stats.levels;
+        } else if ((long long)seen.items() > max_states) {
+            stats.truncated = true;
+            break;
+        }
+    }
+    stats.visited = (long long)seen.items();
+    stats.false_positive_rate = seen.estimated_false_positive_rate();
+    return stats;
+}
+
+#endif // APPROX_VISITED_H
@@ -0,0 +1,203 @@
+// --- Beam search: best-first limitado en anchura con memoria acotada ---
+//
+// Cuando A* agota su límite de nodos no devuelve nada. Beam search avanza por
+// capas y de cada capa conserva solo los `width` mejores nodos según f = g + h,
+// así que la memoria es O(width) y el trabajo es como mucho width * profundidad
+// expansiones: siempre termina en un tiempo previsible, a cambio de perder la
+// optimalidad y la completitud (la solución puede ser subóptima o no aparecer).
+//
+// Diversidad: los hijos de cada padre se ordenan por f y se numeran; a igual f
+// gana el de menor número, de modo que los primeros hijos de muchos padres
+// pasan antes que los segundos hijos de unos pocos. Opcionalmente se limita
+// cuántos hijos de un mismo padre pueden entrar en la capa.
+//
+// Expansión parcial: los candidatos se filtran con un montículo de tamaño
+// `width` mientras se generan (nunca se guarda la capa completa) y los
+// duplicados se detectan con una tabla de tamaño fijo (mapeo directo), así que
+// la memoria no crece con la profundidad.
+
+#ifndef BEAM_SEARCH_H
+#define BEAM_SEARCH_H
+
+#include "search_core.h"
+
+#include <limits>
+#include <vector>
+#include <algorithm>
+
+struct BeamOptions {
+    int width = 1000;                  // Nodos que sobreviven en cada capa
+    int max_children_per_parent = 0;   // Tope de hijos por padre en la capa siguiente (0 = sin tope)
+    size_t dedupe_entries = 1 << 16;   // Tabla fija de estados recientes (0 = sin deduplicar)
+    int max_depth = 10000;             // Capas como máximo (trabajo <= width * max_depth)
+};
+
+struct BeamStats : SearchStats {
+    int levels = 0;             // Capas completadas
+    size_t peak_beam = 0;       // Mayor capa (<= width)
+    long long dropped = 0;      // Hijos descartados por el ancho o por el tope por padre
+};
+
+template <class State>
+struct BeamNode {
+    State state;
+    int g;
+    int f;
+    int rank;         // Posición entre los hijos de su padre (diversidad)
+    uint64_t hash;    // Último desempate, estable entre ejecuciones
+    bool operator<(const BeamNode &other) const {
+        if (f != other.f) return f < other.f;
+        if (rank != other.rank) return rank < other.rank;
+        return hash < other.hash;
+    }
+};
+
+/**
+ * @brief Beam search reanudable: cada unidad de trabajo es la expansión de un padre (stepper.h).
+ *
+ * La capa en curso, la siguiente y la tabla de duplicados sobreviven entre
+ * llamadas a step(); una capa puede quedar a medias entre dos cuantos.
+ */
+template <class P>
+class BeamStepper {
+public:
+    using State = typename P::State;
+    using Node = BeamNode<State>;
+
+    BeamStepper(const P &problem, const BeamOptions &options = BeamOptions())
+        : problem_(problem), options_(options), hasher_{&problem}, width_((size_t)std::max(1, options.width)) {
+        if (options_.dedupe_entries > 0) {
+            size_t cap = 1;
+            while (cap < options_.dedupe_entries) cap <<= 1;
+            seen_.resize(cap);
+        }
+        State start = problem_.initial();
+        uint64_t start_hash = hasher_(start);
+        int h0 = problem_.heuristic(start);
+        if (h0 >= SEARCH_INF) {
+            status_ = STEP_EXHAUSTED;
+            return;
+        }
+        if (problem_.is_goal(start)) {
+            stats_.found = true;
+            stats_.cost = 0;
+            status_ = STEP_FOUND;
+            return;
+        }
+        already_seen(start, start_hash, 0);
+        beam_.push_back({start, 0, h0, 0, start_hash});
+        if (options_.max_depth <= 0) status_ = STEP_EXHAUSTED;
+    }
+
+    StepStatus step(long long budget) {
+        while (budget > 0 && status_ == STEP_RUNNING) {
+            if (index_ == beam_.size()) {
+                // Capa completa: la siguiente pasa a ser la actual.
+                stats_.levels++;
+                beam_.swap(next_);
+                next_.clear(); // Montículo máximo: el peor candidato arriba, listo para ser desplazado
+                index_ = 0;
+                stats_.peak_beam = std::max(stats_.peak_beam, beam_.size());
+                if (beam_.empty() || stats_.levels >= options_.max_depth) status_ = STEP_EXHAUSTED;
+                continue;
+            }
+            budget--;
+            expand(beam_[index_++]);
+            if (stats_.found) {
+                stats_.levels++;
+                status_ = STEP_FOUND;
+            }
+        }
+        return status_;
+    }
+
+    long long work() const { return stats_.expanded; }
+    const BeamStats &stats() const { return stats_; }
+
+private:
+    struct Seen {
+        State key;
+        int g;
+        bool used = false;
+    };
+
+    // ¿Ya se vio s con un g igual o menor? Si no, lo registra.
+    bool already_seen(const State &s, uint64_t h, int g) {
+        if (seen_.empty()) return false;
+        Seen &slot = seen_[h & (seen_.size() - 1)];
+        if (slot.used && slot.key == s && slot.g <= g) return true;
+        slot.key = s;
+        slot.g = g;
+        slot.used = true;
+        return false;
+    }
+
+    // Expande un padre y pasa sus mejores hijos por el montículo de la capa siguiente.
+    void expand(const Node &parent) {
+        stats_.expanded++;
+        SEARCH_TRACE(TRACE_EXPAND, parent.hash, stats_.levels, parent.g, parent.f - parent.g);
+        children_.clear();
+        problem_.expand(parent.state, [&](const State &s, int step_cost) {
+            stats_.generated++;
+            int g = parent.g + step_cost;
+            uint64_t h_s = hasher_(s);
+            int h = problem_.heuristic(s);
+            if (h >= SEARCH_INF || already_seen(s, h_s, g)) {
+                SEARCH_TRACE(TRACE_PRUNE, h_s, stats_.levels + 1, g, h >= SEARCH_INF ? -1 : h);
+                return;
+            }
+            SEARCH_TRACE(TRACE_GENERATE, h_s, stats_.levels + 1, g, h);
+            if (!stats_.found && problem_.is_goal(s)) {
+                SEARCH_TRACE(TRACE_GOAL, h_s, stats_.levels + 1, g, 0);
+                stats_.found = true;
+                stats_.cost = g;
+            }
+            children_.push_back({s, g, g + h, 0, h_s});
+        });
+        if (stats_.found) return;
+
+        std::sort(children_.begin(), children_.end());
+        size_t keep = children_.size();
+        if (options_.max_children_per_parent > 0) keep = std::min(keep, (size_t)options_.max_children_per_parent);
+        stats_.dropped += children_.size() - keep;
+        for (size_t i = 0; i < keep; ++i) {
+            Node &child = children_[i];
+            child.rank = (int)i;
+            if (next_.size() < width_) {
+                next_.push_back(child);
+                std::push_heap(next_.begin(), next_.end());
+            } else if (child < next_.front()) {
+                std::pop_heap(next_.begin(), next_.end());
+                next_.back() = child;
+                std::push_heap(next_.begin(), next_.end());
+                stats_.dropped++;
+            } else {
+                stats_.dropped++;
+            }
+        }
+    }
+
+    const P &problem_;
+    BeamOptions options_;
+    ProblemHasher<P> hasher_;
+    size_t width_;
+    std::vector<Seen> seen_;
+    std::vector<Node> beam_, next_, children_;
+    size_t index_ = 0;          // Siguiente padre de la capa actual
+    BeamStats stats_;
+    StepStatus status_ = STEP_RUNNING;
+};
+
+/**
+ * @brief Beam search por capas con deduplicación de tamaño fijo.
+ * @param problem Problema con la interfaz descrita en search_core.h.
+ * @return Estadísticas; cost es el de la primera solución hallada (no necesariamente óptima).
+ */
+template <class P>
+BeamStats beam_search(const P &problem, const BeamOptions &options = BeamOptions()) {
+    BeamStepper<P> stepper(problem, options);
+    stepper.step(std::numeric_limits<long long>::max());
+    return stepper.stats();
+}
+
+#endif // BEAM_SEARCH_H
@@ -0,0 +1,122 @@
+// --- Búsqueda bidireccional (encuentro en el medio) ---
+//
+// Para problemas con un único objetivo explícito y predecesores enumerables.
+// Además de la interfaz de search_core.h, el problema debe ofrecer:
+//
+//   State goal_state() const;                               // el objetivo, totalmente especificado
+//   template <class Visit>
+//   void expand_reverse(const State &s, Visit &&visit) const; // predecesores: visit(pred, costo)
+//
+// Dos BFS por niveles (costo unitario) avanzan alternadamente desde el inicio
+// y desde el objetivo, expandiendo siempre la frontera más pequeña. Con una
+// solución de largo L cada lado solo explora hasta ~L/2, así que el conjunto
+// explorado pasa de O(b^L) a O(b^(L/2)).
+
+#ifndef BIDIRECTIONAL_SEARCH_H
+#define BIDIRECTIONAL_SEARCH_H
+
+#include "search_core.h"
+
+#include <vector>
+#include <algorithm>
+
+template <class State>
+struct BidirStats : SearchStats {
+    State meeting{};                 // Estado donde se encontraron ambas búsquedas
+    int forward_depth = 0;           // Distancia del inicio al encuentro
+    int backward_depth = 0;          // Distancia del encuentro al objetivo
+    long long forward_states = 0;    // Estados guardados por cada lado
+    long long backward_states = 0;
+    std::vector<State> path;         // Camino reconstruido inicio -> objetivo
+};
+
+/**
+ * @brief BFS bidireccional frente a frente con reconstrucción del camino.
+ * @param max_states Límite de estados guardados entre ambos lados.
+ */
+template <class P>
+BidirStats<typename P::State> bidirectional_bfs(const P &problem, long long max_states = 20000000) {
+    using State = typename P::State;
+    struct Parent {
+        State parent;
+        int depth;
+    };
+    using Table = StateTable<State, Parent, ProblemHasher<P>>;
+
+    BidirStats<State> stats;
+    ProblemHasher<P> hasher{&problem};
+    Table forward(hasher), backward(hasher);
+    State start = problem.initial(), goal = problem.goal_state();
+    forward.insert(start, {start, 0});
+    backward.insert(goal, {goal, 0});
+    std::vector<State> frontier_f = {start}, frontier_b = {goal}, next;
+
+    int best = start == goal ? 0 : SEARCH_INF;
+    State meeting = start;
+
+    // Expande un nivel completo de un lado; registra el mejor encuentro con el otro.
+    auto expand_level = [&](bool is_forward) {
+        std::vector<State> &frontier = is_forward ? frontier_f : frontier_b;
+        Table &own = is_forward ? forward : backward;
+        Table &other = is_forward ? backward : forward;
+        next.clear();
+        for (const State &s : frontier) {
+            int d = own.find(s)->depth;
+            stats.expanded++;
+            SEARCH_TRACE(TRACE_EXPAND, hasher(s), d, d, -1);
+            auto visit = [&](const State &n, int) {
+                stats.generated++;
+                if (!own.insert(n, {s, d + 1}).second) {
+                    SEARCH_TRACE(TRACE_PRUNE, hasher(n), d + 1, d + 1, -1);
+                    return;
+                }
+                SEARCH_TRACE(TRACE_GENERATE, hasher(n), d + 1, d + 1, -1);
+                next.push_back(n);
+                if (const Parent *o = other.find(n)) {
+                    SEARCH_TRACE(TRACE_GOAL, hasher(n), d + 1, d + 1, o->depth);
+                    if (d + 1 + o->depth < best) {
+                        best = d + 1 + o->depth;
+                        meeting = n;
+                    }
+                }
+            };
+            if (is_forward) problem.expand(s, visit);
+            else problem.expand_reverse(s, visit);
+        }
+        frontier.swap(next);
+    };
+
+    // Un encuentro detectado al completar un nivel es óptimo: cualquier camino más
+    // corto tendría un estado en ambas tablas antes de este nivel.
+    while (best == SEARCH_INF && !frontier_f.empty() && !frontier_b.empty()) {
+        if ((long long)(forward.size() + backward.size()) > max_states) {
+            stats.truncated = true;
+            break;
+        }
+        expand_level(frontier_f.size() <= frontier_b.size());
+    }
+
+    stats.forward_states = forward.size();
+    stats.backward_states = backward.size();
+    if (best == SEARCH_INF) return stats;
+
+    stats.found = true;
+    stats.cost = best;
+    stats.meeting = meeting;
+    stats.forward_depth = forward.find(meeting)->depth;
+    stats.backward_depth = backward.find(meeting)->depth;
+    // Mitad delantera: del encuentro hacia el inicio, luego se invierte.
+    for (State s = meeting; ; s = forward.find(s)->parent) {
+        stats.path.push_back(s);
+        if (s == start) break;
+    }
+    std::reverse(stats.path.begin(), stats.path.end());
+    // Mitad trasera: del encuentro hacia el objetivo siguiendo los padres del lado inverso.
+    for (State s = meeting; !(s == goal);) {
+        s = backward.find(s)->parent;
+        stats.path.push_back(s);
+    }
+    return stats;
+}
+
+#endif // BIDIRECTIONAL_SEARCH_H
@@ -0,0 +1,183 @@
+// --- Checkpoints binarios para búsquedas largas ---
+//
+// Un checkpoint es un archivo con cabecera {"SCKP", versión, tamaño del estado,
+// huella del problema} seguida de los datos que cada motor decida volcar
+// (contadores, frontera, visitados). Se escribe primero en "<ruta>.tmp" y luego
+// se renombra, así que un corte a mitad de escritura deja intacto el anterior.
+//
+// La huella (checkpoint_fingerprint) combina una etiqueta del motor con los
+// parámetros de la instancia que el problema declara en fingerprint() (postes
+// y discos, N, casilla de salida, grafo...). El hash del estado inicial no
+// basta: todas las instancias de una familia suelen empezar en el mismo estado
+// (en Hanói es siempre 0). Los estados se escriben tal cual: deben ser
+// trivialmente copiables.
+//
+// Motores con checkpoints: parallel_bfs (frontera y visitados al cerrar cada
+// nivel) y nqueens_count_parallel (prefijos ya contados). Los conteos en
+// profundidad de un solo hilo (nqueens_bitboard_count, nqueens_fixed, DLX)
+// no tienen una unidad reanudable más pequeña que la búsqueda entera; para un
+// conteo secuencial reanudable se usa nqueens_count_parallel con un hilo. El
+// caballo no tiene conteo de recorridos: sus motores paran en el primero.
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <initializer_list>
+#include <type_traits>
+
+const uint32_t CHECKPOINT_MAGIC = 0x504b4353; // "SCKP" en little-endian
+const uint32_t CHECKPOINT_VERSION = 2;        // 2: huella con parámetros de la instancia y motor
+const uint64_t CHECKPOINT_FINGERPRINT_SEED = 0xcbf29ce484222325ULL;
+
+// FNV-1a de 64 bits sobre los bytes de cada valor, encadenado desde h.
+inline uint64_t checkpoint_hash(std::initializer_list<uint64_t> values, uint64_t h = CHECKPOINT_FINGERPRINT_SEED) {
+    for (uint64_t value : values) {
+        for (int byte = 0; byte < 8; ++byte) {
+            h ^= (value >> (8 * byte)) & 0xff;
+            h *= 0x100000001b3ULL;
+        }
+    }
+    return h;
+}
+
+inline uint64_t checkpoint_hash(const char *text, uint64_t h = CHECKPOINT_FINGERPRINT_SEED) {
+    for (; *text != '\0'; ++text) {
+        h ^= (unsigned char)*text;
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+// Huella de la instancia: fingerprint() si el problema la define; si no, el hash del estado inicial.
+template <class P>
+auto checkpoint_instance_fingerprint(const P &problem, int) -> decltype((uint64_t)problem.fingerprint()) {
+    return problem.fingerprint();
+}
+template <class P>
+uint64_t checkpoint_instance_fingerprint(const P &problem, long) {
+    return problem.hash(problem.initial());
+}
+
+/**
+ * @brief Huella de un checkpoint: motor (engine, p. ej. "parallel_bfs") + instancia del problema.
+ */
+template <class P>
+uint64_t checkpoint_fingerprint(const P &problem, const char *engine) {
+    return checkpoint_hash({checkpoint_instance_fingerprint(problem, 0)}, checkpoint_hash(engine));
+}
+
+// Configuración de checkpoints de un motor. Sin ruta no se escribe nada.
+struct CheckpointConfig {
+    const char *path = nullptr;
+    double interval_seconds = 60.0;  // Tiempo mínimo entre dos checkpoints
+
+    /**
+     * @brief Lee SEARCH_CHECKPOINT_FILE y SEARCH_CHECKPOINT_SECONDS del entorno.
+     */
+    static CheckpointConfig from_env() {
+        CheckpointConfig config;
+        const char *path = std::getenv("SEARCH_CHECKPOINT_FILE");
+        if (path != nullptr && *path != '\0') config.path = path;
+        const char *seconds = std::getenv("SEARCH_CHECKPOINT_SECONDS");
+        if (seconds != nullptr && std::atof(seconds) > 0) config.interval_seconds = std::atof(seconds);
+        return config;
+    }
+};
+
+class CheckpointWriter {
+public:
+    CheckpointWriter(const char *path, uint32_t state_size, uint64_t fingerprint)
+        : path_(path), tmp_path_(std::string(path) + ".tmp"), file_(std::fopen(tmp_path_.c_str(), "wb")) {
+        uint32_t header[3] = {CHECKPOINT_MAGIC, CHECKPOINT_VERSION, state_size};
+        write(header);
+        write(fingerprint);
+    }
+    ~CheckpointWriter() {
+        if (file_ != nullptr) std::fclose(file_);
+    }
+    CheckpointWriter(const CheckpointWriter &) = delete;
+    CheckpointWriter &operator=(const CheckpointWriter &) = delete;
+
+    template <class T>
+    void write(const T &value) {
+        static_assert(std::is_trivially_copyable<T>::value, "Solo se vuelcan tipos trivialmente copiables");
+        if (file_ != nullptr && std::fwrite(&value, sizeof(T), 1, file_) != 1) fail();
+    }
+
+    template <class T>
+    void write_vector(const std::vector<T> &values) {
+        static_assert(std::is_trivially_copyable<T>::value, "Solo se vuelcan tipos trivialmente copiables");
+        write((uint64_t)values.size());
+        if (file_ != nullptr && !values.empty() &&
+            std::fwrite(values.data(), sizeof(T), values.size(), file_) != values.size()) fail();
+    }
+
+    // Cierra el temporal y lo renombra sobre la ruta final. Devuelve false si algo falló.
+    bool commit() {
+        if (file_ == nullptr) return false;
+        bool ok = std::fflush(file_) == 0;
+        ok = std::fclose(file_) == 0 && ok;
+        file_ = nullptr;
+        if (!ok) {
+            std::remove(tmp_path_.c_str());
+            return false;
+        }
+        return std::rename(tmp_path_.c_str(), path_.c_str()) == 0;
+    }
+
+private:
+    void fail() {
+        std::fclose(file_);
+        file_ = nullptr;
+        std::remove(tmp_path_.c_str());
+    }
+
+    std::string path_;
+    std::string tmp_path_;
+    std::FILE *file_;
+};
+
+class CheckpointReader {
+public:
+    // Abre el checkpoint solo si existe y coincide con el problema actual.
+    CheckpointReader(const char *path, uint32_t state_size, uint64_t fingerprint)
+        : file_(std::fopen(path, "rb")) {
+        uint32_t header[3];
+        uint64_t stored = 0;
+        ok_ = read(header) && read(stored) && header[0] == CHECKPOINT_MAGIC &&
+              header[1] == CHECKPOINT_VERSION && header[2] == state_size && stored == fingerprint;
+    }
+    ~CheckpointReader() {
+        if (file_ != nullptr) std::fclose(file_);
+    }
+    CheckpointReader(const CheckpointReader &) = delete;
+    CheckpointReader &operator=(const CheckpointReader &) = delete;
+
+    bool ok() const { return ok_; }
+
+    template <class T>
+    bool read(T &value) {
+        ok_ = ok_ && file_ != nullptr && std::fread(&value, sizeof(T), 1, file_) == 1;
+        return ok_;
+    }
+
+    template <class T>
+    bool read_vector(std::vector<T> &values) {
+        uint64_t n = 0;
+        if (!read(n)) return false;
+        values.resize(n);
+        ok_ = n == 0 || std::fread(values.data(), sizeof(T), n, file_) == n;
+        return ok_;
+    }
+
+private:
+    std::FILE *file_;
+    bool ok_ = true;
+};
+
+#endif // CHECKPOINT_H
@@ -0,0 +1,214 @@
+// --- Dancing Links (Algoritmo X de Knuth) para problemas de cobertura exacta ---
+//
+// Un problema de cobertura exacta es una matriz 0/1: elegir filas de modo que
+// cada columna primaria quede cubierta exactamente una vez y cada columna
+// secundaria a lo sumo una vez. N-Reinas encaja directamente: una fila por
+// casilla (r, c), columnas primarias "fila r" y "columna c", y secundarias
+// para las dos diagonales (pueden quedar vacías).
+//
+// Los nodos viven en un único arreglo (índices de 32 bits en lugar de
+// punteros): cabecera raíz en 0, cabeceras de columna en 1..columnas y
+// después los nodos de cada fila, contiguos. Cubrir y descubrir columnas solo
+// reescribe enlaces, así que retroceder no copia estado. La columna a cubrir
+// es siempre la primaria con menos filas (MRV).
+//
+// Modos: contar todas las soluciones, parar en la primera, o buscar la primera
+// recorriendo las filas de cada columna en orden aleatorio (una solución al
+// azar distinta en cada semilla, aunque no uniforme).
+
+#ifndef DANCING_LINKS_H
+#define DANCING_LINKS_H
+
+#include "simulated_annealing.h"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+enum DlxMode { DLX_COUNT_ALL, DLX_FIRST, DLX_RANDOM };
+
+struct DlxOptions {
+    DlxMode mode = DLX_FIRST;
+    long long max_solutions = 0;             // DLX_COUNT_ALL: parar tras este número (0 = todas)
+    uint64_t seed = 1;                       // DLX_RANDOM
+    const std::atomic<bool> *stop = nullptr; // Cancelación externa, cada 1024 nodos
+};
+
+struct DlxStats {
+    bool found = false;
+    bool stopped = false;     // Cancelado o límite de soluciones alcanzado
+    long long solutions = 0;
+    long long nodes = 0;      // Filas probadas
+    long long updates = 0;    // Enlaces reescritos al cubrir columnas
+};
+
+/**
+ * @brief Matriz de cobertura exacta con columnas primarias y secundarias.
+ *
+ * Columnas 0..primary-1 primarias, primary..primary+secondary-1 secundarias.
+ * Las filas se numeran en el orden de add_row.
+ */
+class DancingLinks {
+public:
+    DancingLinks(int primary, int secondary) : primary_(primary), size_(primary + secondary, 0) {
+        const int columns = primary + secondary;
+        nodes_.resize(columns + 1);
+        for (int c = 0; c <= columns; ++c) {
+            Node &n = nodes_[c];
+            n.up = n.down = c;
+            n.column = c;
+            n.row = -1;
+        }
+        // Solo las primarias se enlazan a la raíz; las secundarias quedan como lista propia.
+        for (int c = 0; c <= primary; ++c) {
+            nodes_[c].left = c == 0 ? primary : c - 1;
+            nodes_[c].right = c == primary ? 0 : c + 1;
+        }
+        for (int c = primary + 1; c <= columns; ++c) nodes_[c].left = nodes_[c].right = c;
+    }
+
+    int columns() const { return (int)size_.size(); }
+    int rows() const { return rows_; }
+
+    /**
+     * @brief Añade una fila con las columnas indicadas (sin repetir). Devuelve su número.
+     */
+    int add_row(const std::vector<int> &columns) {
+        const int row = rows_++;
+        if (columns.empty()) return row;
+        const int first = (int)nodes_.size();
+        for (size_t k = 0; k < columns.size(); ++k) {
+            const int header = columns[k] + 1;
+            const int index = (int)nodes_.size();
+            Node n;
+            n.column = header;
+            n.row = row;
+            n.left = k == 0 ? index : index - 1;
+            n.right = first;
+            n.down = header;
+            n.up = nodes_[header].up;
+            nodes_.push_back(n);
+            nodes_[nodes_[header].up].down = index;
+            nodes_[header].up = index;
+            nodes_[first].left = index;
+            if (k > 0) nodes_[index - 1].right = index;
+            size_[columns[k]]++;
+        }
+        return row;
+    }
+
+    /**
+     * @brief Resuelve la cobertura exacta.
+     * @param solution Salida opcional: filas de la primera solución (o de la aleatoria).
+     */
+    DlxStats solve(const DlxOptions &options, std::vector<int> *solution = nullptr) {
+        DlxStats stats;
+        Search search{*this, options, stats, solution, SaRng(options.seed), {}, {}};
+        search.picked.reserve(primary_);
+        search.run();
+        stats.found = stats.solutions > 0;
+        return stats;
+    }
+
+private:
+    struct Node {
+        int left, right, up, down;
+        int column; // Cabecera (1..columnas)
+        int row;
+    };
+
+    void cover(int header, long long &updates) {
+        nodes_[nodes_[header].right].left = nodes_[header].left;
+        nodes_[nodes_[header].left].right = nodes_[header].right;
+        for (int i = nodes_[header].down; i != header; i = nodes_[i].down) {
+            for (int j = nodes_[i].right; j != i; j = nodes_[j].right) {
+                nodes_[nodes_[j].down].up = nodes_[j].up;
+                nodes_[nodes_[j].up].down = nodes_[j].down;
+                size_[nodes_[j].column - 1]--;
+                updates++;
+            }
+        }
+    }
+
+    void uncover(int header) {
+        for (int i = nodes_[header].up; i != header; i = nodes_[i].up) {
+            for (int j = nodes_[i].left; j != i; j = nodes_[j].left) {
+                size_[nodes_[j].column - 1]++;
+                nodes_[nodes_[j].down].up = j;
+                nodes_[nodes_[j].up].down = j;
+            }
+        }
+        nodes_[nodes_[header].right].left = header;
+        nodes_[nodes_[header].left].right = header;
+    }
+
+    struct Search {
+        DancingLinks &dlx;
+        const DlxOptions &options;
+        DlxStats &stats;
+        std::vector<int> *solution;
+        SaRng rng;
+        std::vector<int> picked;     // Nodo elegido en cada nivel
+        std::vector<int> candidates; // DLX_RANDOM: filas de la columna actual (pila compartida por niveles)
+
+        // true = parar (primera solución, límite o cancelación)
+        bool run() {
+            std::vector<Node> &nodes = dlx.nodes_;
+            if (nodes[0].right == 0) {
+                stats.solutions++;
+                if (solution != nullptr && stats.solutions == 1) {
+                    solution->clear();
+                    for (int node : picked) solution->push_back(nodes[node].row);
+                }
+                if (options.mode != DLX_COUNT_ALL) return true;
+                if (options.max_solutions > 0 && stats.solutions >= options.max_solutions) {
+                    stats.stopped = true;
+                    return true;
+                }
+                return false;
+            }
+            // MRV: la columna primaria con menos filas
+            int header = nodes[0].right;
+            for (int c = nodes[header].right; c != 0; c = nodes[c].right) {
+                if (dlx.size_[c - 1] < dlx.size_[header - 1]) header = c;
+            }
+            if (dlx.size_[header - 1] == 0) return false;
+
+            dlx.cover(header, stats.updates);
+            const size_t base = candidates.size();
+            if (options.mode == DLX_RANDOM) {
+                for (int i = nodes[header].down; i != header; i = nodes[i].down) candidates.push_back(i);
+                for (size_t k = candidates.size() - 1; k > base; --k) {
+                    std::swap(candidates[k], candidates[base + rng.below((int)(k - base + 1))]);
+                }
+            }
+            bool halt = false;
+            size_t next = base;
+            for (int i = nodes[header].down; i != header && !halt; i = nodes[i].down) {
+                int row = i;
+                if (options.mode == DLX_RANDOM) row = candidates[next++];
+                if ((++stats.nodes & 1023) == 0 && options.stop != nullptr && options.stop->load(std::memory_order_relaxed)) {
+                    stats.stopped = true;
+                    halt = true;
+                    break;
+                }
+                picked.push_back(row);
+                for (int j = nodes[row].right; j != row; j = nodes[j].right) dlx.cover(nodes[j].column, stats.updates);
+                halt = run();
+                for (int j = nodes[row].left; j != row; j = nodes[j].left) dlx.uncover(nodes[j].column);
+                picked.pop_back();
+            }
+            candidates.resize(base);
+            dlx.uncover(header);
+            return halt;
+        }
+    };
+
+    int primary_;
+    int rows_ = 0;
+    std::vector<Node> nodes_;
+    std::vector<int> size_; // Filas activas por columna (índice de columna, base 0)
+};
+
+#endif // DANCING_LINKS_H
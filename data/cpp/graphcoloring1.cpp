@@ -14,6 +14,17 @@
 #include <cstdlib>
 #include <ctime>
 
+#include "hda_star.h"
+#include "spill_search.h"
+#include "parallel_bfs.h"
+#include "anytime_profile.h"
+#include "simulated_annealing.h"
+#include "portfolio.h"
+#include "stepper.h"
+#include "state_intern.h"
+#include "approx_visited.h"
+#include "tabu_search.h"
+
 using namespace std;
 using namespace std::chrono;
 
@@ -30,6 +41,7 @@ struct Result {
     double duration_ms;
     bool found;
     long long metric_value = 0;
+    string profile = ""; // Curva "ms:objetivo" de las búsquedas local / anytime
 };
 
 bool is_safe(int v, int color, const Graph& graph, const ColorAssignment& colorDeV) {
@@ -96,11 +108,25 @@ Result run_bfs_coloring(int V, int M, const Graph& graph) {
         return next;
     };
 
+    // Traza: profundidad = vértices ya coloreados.
+    auto trace_depth = [&](const State &s) { return V - (int)count(s.colors.begin(), s.colors.end(), 0); };
+
     while (!q.empty()) {
         State current = q.front(); q.pop();
-        if (current.colors.size() == (size_t)V && is_goal_valid(current.colors, V, graph)) { found = true; break; }
+        SEARCH_TRACE(TRACE_EXPAND, trace_hash_value(current.colors), trace_depth(current), trace_depth(current), -1);
+        if (current.colors.size() == (size_t)V && is_goal_valid(current.colors, V, graph)) {
+            SEARCH_TRACE(TRACE_GOAL, trace_hash_value(current.colors), trace_depth(current), trace_depth(current), 0);
+            found = true;
+            break;
+        }
         for (auto &next : get_neighbors(current)) {
-            if (!visited.count(next)) { visited.insert(next); q.push(next); }
+            if (!visited.count(next)) {
+                SEARCH_TRACE(TRACE_GENERATE, trace_hash_value(next.colors), trace_depth(next), trace_depth(next), -1);
+                visited.insert(next);
+                q.push(next);
+            } else {
+                SEARCH_TRACE(TRACE_PRUNE, trace_hash_value(next.colors), trace_depth(next), trace_depth(next), -1);
+            }
         }
         if (visited.size() > 50000) break;
     }
@@ -116,6 +142,7 @@ struct AStarNode {
 
 Result run_a_star_coloring(int V, int M, const Graph& graph) {
     auto start_time = high_resolution_clock::now();
+    AnytimeProfile profile; // Mejor objetivo vs. tiempo
     bool found = false;
     ColorAssignment initial_colors(V, 0);
     priority_queue<AStarNode, vector<AStarNode>, greater<AStarNode>> pq;
@@ -127,7 +154,13 @@ Result run_a_star_coloring(int V, int M, const Graph& graph) {
     while (!pq.empty()) {
         AStarNode current = pq.top(); pq.pop();
         nodes_visited++;
-        if (current.colored_count == V) { found = true; break; }
+        profile.record(V - current.colored_count); // Vértices sin color
+        SEARCH_TRACE(TRACE_EXPAND, trace_hash_value(current.colors), current.colored_count, current.g, current.h);
+        if (current.colored_count == V) {
+            SEARCH_TRACE(TRACE_GOAL, trace_hash_value(current.colors), current.colored_count, current.g, 0);
+            found = true;
+            break;
+        }
         int node_to_color = -1;
         for (int i = 0; i < V; ++i) { if (current.colors[i] == 0) { node_to_color = i; break; } }
         if (node_to_color == -1) continue;
@@ -140,15 +173,20 @@ Result run_a_star_coloring(int V, int M, const Graph& graph) {
                 next_colors[node_to_color] = color_to_try;
                 int g_successor = (color_to_try == g_current + 1) ? g_current + 1 : g_current;
                 if (closed_set.find(next_colors) == closed_set.end() || g_successor < closed_set[next_colors]) {
+                    SEARCH_TRACE(TRACE_GENERATE, trace_hash_value(next_colors), current.colored_count + 1, g_successor, 0);
                     closed_set[next_colors] = g_successor;
                     pq.push({next_colors, g_successor, 0, g_successor, current.colored_count + 1});
+                } else {
+                    SEARCH_TRACE(TRACE_PRUNE, trace_hash_value(next_colors), current.colored_count + 1, g_successor, -1);
                 }
             }
         }
         if (closed_set.size() > 50000) break;
     }
     auto end_time = high_resolution_clock::now();
-    return {"A* (Costo Uniforme)", duration_cast<microseconds>(end_time - start_time).count() / 1000.0, found, nodes_visited};
+    Result result = {"A* (Costo Uniforme)", duration_cast<microseconds>(end_time - start_time).count() / 1000.0, found, nodes_visited};
+    result.profile = profile.to_string();
+    return result;
 }
 
 // Hill Climbing
@@ -163,11 +201,13 @@ int count_conflicts_hc(const ColorAssignment& colors, const Graph& graph) {
 
 Result run_hill_climbing_coloring(int V, int M, const Graph& graph) {
     auto start_time = high_resolution_clock::now();
+    AnytimeProfile profile; // Mejor objetivo vs. tiempo
     bool found = false;
     ColorAssignment current_colors(V);
     srand(time(0));
     for (int i = 0; i < V; ++i) current_colors[i] = (rand() % M) + 1;
     int current_conflicts = count_conflicts_hc(current_colors, graph);
+    profile.record(current_conflicts);
     int iterations = 0;
 
     while (current_conflicts > 0 && iterations < 10000) {
@@ -188,27 +228,369 @@ Result run_hill_climbing_coloring(int V, int M, const Graph& graph) {
             }
             current_colors[v] = original_color;
         }
-        if (improvement) { current_colors = best_colors; current_conflicts = best_conflicts; }
+        if (improvement) { current_colors = best_colors; current_conflicts = best_conflicts; profile.record(current_conflicts); }
         else break;
     }
     if (current_conflicts == 0) found = true;
     auto end_time = high_resolution_clock::now();
-    return {"Hill Climbing (Búsqueda Local)", duration_cast<microseconds>(end_time - start_time).count() / 1000.0, found, (long long)iterations};
+    Result result = {"Hill Climbing (Búsqueda Local)", duration_cast<microseconds>(end_time - start_time).count() / 1000.0, found, (long long)iterations};
+    result.profile = profile.to_string();
+    return result;
+}
+
+// --- Adaptador para el núcleo de búsqueda genérico (search_core.h) ---
+
+// Coloreado con estado empaquetado: 4 bits por vértice (V <= 16, M <= 15), vértices en orden.
+struct ColoringProblem {
+    struct State {
+        uint64_t colors; // Color de cada vértice ya asignado (0 = sin color)
+        int next;        // Siguiente vértice a colorear
+        bool operator==(const State &other) const { return colors == other.colors && next == other.next; }
+    };
+    const Graph &graph; int V, M;
+
+    State initial() const { return {0, 0}; }
+    bool is_goal(const State &s) const { return s.next == V; }
+    int heuristic(const State &s) const { return V - s.next; } // Vértices sin colorear
+    uint64_t hash(const State &s) const { return s.colors * 31 + s.next; }
+    int color_of(const State &s, int v) const { return (int)((s.colors >> (4 * v)) & 15); }
+
+    // Parámetros de la instancia para la huella de los checkpoints (checkpoint.h).
+    uint64_t fingerprint() const {
+        uint64_t h = checkpoint_hash({(uint64_t)V, (uint64_t)M});
+        for (int u = 0; u < V; ++u) {
+            for (int v = 0; v < u; ++v) if (graph[u][v]) h = checkpoint_hash({(uint64_t)u, (uint64_t)v}, h); // Aristas
+        }
+        return h;
+    }
+
+    template <class Visit>
+    void expand(const State &s, Visit &&visit) const {
+        if (s.next == V) return;
+        for (int c = 1; c <= M; ++c) {
+            bool safe = true;
+            for (int u = 0; u < s.next && safe; ++u) if (graph[s.next][u] && color_of(s, u) == c) safe = false;
+            if (safe) visit(State{s.colors | ((uint64_t)c << (4 * s.next)), s.next + 1}, 1);
+        }
+    }
+};
+
+// HDA* - A* paralelo distribuido por hash (usa todos los núcleos)
+Result run_hda_star_coloring(int V, int M, const Graph& graph) {
+    auto start_time = high_resolution_clock::now();
+    if (V > 16 || M > 15) return {"HDA* (Inviable para V > 16)", 0.0, false, 0};
+    ColoringProblem problem{graph, V, M};
+    SearchStats stats = hda_star(problem, 0, 50000);
+    auto end_time = high_resolution_clock::now();
+    return {"HDA* (A* Paralelo)", duration_cast<microseconds>(end_time - start_time).count() / 1000.0, stats.found, stats.expanded};
+}
+
+// BFS con memoria acotada - La frontera que no cabe en RAM se vuelca a disco
+Result run_spill_bfs_coloring(int V, int M, const Graph& graph) {
+    auto start_time = high_resolution_clock::now();
+    if (V > 16 || M > 15) return {"BFS Externo (Inviable para V > 16)", 0.0, false, 0};
+    ColoringProblem problem{graph, V, M};
+    SpillStats stats = spill_search(problem, 1 << 20, false); // 1 MB de frontera en RAM, orden por g
+    auto end_time = high_resolution_clock::now();
+    return {"BFS Externo (Frontera en Disco)", duration_cast<microseconds>(end_time - start_time).count() / 1000.0, stats.found, stats.expanded};
+}
+
+// BFS Paralelo - Síncrono por niveles con frontera empaquetada
+Result run_parallel_bfs_coloring(int V, int M, const Graph& graph) {
+    auto start_time = high_resolution_clock::now();
+    if (V > 16 || M > 15) return {"BFS Paralelo (Inviable para V > 16)", 0.0, false, 0};
+    ColoringProblem problem{graph, V, M};
+    ParallelBfsStats stats = parallel_bfs(problem, 0, 50000);
+    auto end_time = high_resolution_clock::now();
+    return {"BFS Paralelo (Por Niveles)", duration_cast<microseconds>(end_time - start_time).count() / 1000.0, stats.found, stats.visited};
+}
+
+// BFS con visitados aproximados (filtro de Bloom): completitud probabilística
+Result run_approx_bfs_coloring(int V, int M, const Graph& graph) {
+    auto start_time = high_resolution_clock::now();
+    if (V > 16 || M > 15) return {"BFS Aproximado (Inviable para V > 16)", 0.0, false, 0};
+    ColoringProblem problem{graph, V, M};
+    ApproxBfsStats stats = approx_bfs(problem, 50000, 1e-3);
+    auto end_time = high_resolution_clock::now();
+    return {"BFS Aproximado (Bloom, Probabilístico)", duration_cast<microseconds>(end_time - start_time).count() / 1000.0, stats.found, stats.visited};
+}
+
+// Coloreado para recocido simulado: por cada vértice se cuenta cuántos vecinos
+// tienen cada color, así el cambio de conflictos al recolorear es O(1). Los
+// vértices en conflicto se guardan en un conjunto indexado para proponer en O(1).
+class ColoringAnnealing {
+public:
+    struct Move { int v, color; };
+
+    ColoringAnnealing(const Graph &graph, int V, int M, SaRng &rng)
+        : V(V), M(M), neighbors(V), colors(V), neighbor_colors(V * (M + 1), 0), slot(V, -1) {
+        for (int v = 0; v < V; ++v) for (int u = 0; u < V; ++u) if (u != v && graph[v][u]) neighbors[v].push_back(u);
+        for (int v = 0; v < V; ++v) colors[v] = rng.below(M) + 1;
+        for (int v = 0; v < V; ++v) for (int u : neighbors[v]) {
+            neighbor_colors[v * (M + 1) + colors[u]]++;
+            if (u < v && colors[u] == colors[v]) conflicts++;
+        }
+        for (int v = 0; v < V; ++v) refresh(v);
+    }
+
+    long long cost() const { return conflicts; }
+
+    // Se recolorea un vértice en conflicto (o cualquiera si no hay).
+    Move propose(SaRng &rng) const {
+        int v = conflicted.empty() ? rng.below(V) : conflicted[rng.below((int)conflicted.size())];
+        if (M == 1) return {v, colors[v]};
+        int c = rng.below(M - 1) + 1;
+        return {v, c >= colors[v] ? c + 1 : c};
+    }
+
+    long long delta(const Move &m) const { return count(m.v, m.color) - count(m.v, colors[m.v]); }
+
+    void apply(const Move &m) {
+        conflicts += delta(m);
+        for (int u : neighbors[m.v]) {
+            neighbor_colors[u * (M + 1) + colors[m.v]]--;
+            neighbor_colors[u * (M + 1) + m.color]++;
+        }
+        colors[m.v] = m.color;
+        refresh(m.v);
+        for (int u : neighbors[m.v]) refresh(u);
+    }
+
+private:
+    int count(int v, int c) const { return neighbor_colors[v * (M + 1) + c]; }
+
+    // Mantiene v dentro o fuera del conjunto de vértices en conflicto.
+    void refresh(int v) {
+        bool in_conflict = count(v, colors[v]) > 0;
+        if (in_conflict && slot[v] < 0) {
+            slot[v] = (int)conflicted.size();
+            conflicted.push_back(v);
+        } else if (!in_conflict && slot[v] >= 0) {
+            int last = conflicted.back();
+            conflicted[slot[v]] = last;
+            slot[last] = slot[v];
+            conflicted.pop_back();
+            slot[v] = -1;
+        }
+    }
+
+    int V, M;
+    vector<vector<int>> neighbors;
+    ColorAssignment colors;       // Colores 1..M
+    vector<int> neighbor_colors;  // [v * (M + 1) + c] = vecinos de v con color c
+    vector<int> conflicted;       // Vértices con algún vecino del mismo color
+    vector<int> slot;             // Posición de cada vértice en "conflicted" (-1 = fuera)
+    long long conflicts = 0;
+};
+
+// Recocido Simulado - Búsqueda local que escapa de óptimos locales
+Result run_simulated_annealing_coloring(int V, int M, const Graph& graph) {
+    auto start_time = high_resolution_clock::now();
+    AnytimeProfile profile; // Mejor objetivo vs. tiempo
+    SaRng rng(std::chrono::system_clock::now().time_since_epoch().count());
+    ColoringAnnealing problem(graph, V, M, rng);
+    SaOptions options;
+    options.max_iterations = max(200000LL, 2000LL * V);
+    options.reheat_after = max(2000LL, 50LL * V);
+    options.seed = rng.next();
+    SaStats stats = simulated_annealing(problem, GeometricCooling{0.6, 0.99999}, options, &profile);
+    auto end_time = high_resolution_clock::now();
+    Result result = {"Recocido Simulado (Delta O(1))", duration_cast<microseconds>(end_time - start_time).count() / 1000.0, stats.found, stats.iterations};
+    result.profile = profile.to_string();
+    return result;
+}
+
+// Coloreado para búsqueda tabú: variable = vértice, valor = color - 1. Igual que
+// en el recocido, se cuenta cuántos vecinos tienen cada color, así delta() es
+// O(1) y assign() solo actualiza a los vecinos del vértice recoloreado.
+class ColoringTabu {
+public:
+    ColoringTabu(const Graph &graph, int V, int M, SaRng &rng)
+        : V(V), M(M), neighbors(V), colors(V), neighbor_colors(V * (M + 1), 0), slot(V, -1) {
+        for (int v = 0; v < V; ++v) for (int u = 0; u < V; ++u) if (u != v && graph[v][u]) neighbors[v].push_back(u);
+        for (int v = 0; v < V; ++v) colors[v] = rng.below(M) + 1;
+        for (int v = 0; v < V; ++v) for (int u : neighbors[v]) {
+            neighbor_colors[v * (M + 1) + colors[u]]++;
+            if (u < v && colors[u] == colors[v]) conflicts++;
+        }
+        for (int v = 0; v < V; ++v) refresh(v);
+    }
+
+    long long cost() const { return conflicts; }
+    int variables() const { return V; }
+    int values() const { return M; }
+    int value(int v) const { return colors[v] - 1; }
+    int conflicted_count() const { return (int)clashing.size(); }
+    int conflicted(int i) const { return clashing[i]; }
+
+    long long delta(int v, int value) const { return count(v, value + 1) - count(v, colors[v]); }
+
+    void assign(int v, int value) {
+        int color = value + 1;
+        conflicts += delta(v, value);
+        for (int u : neighbors[v]) {
+            neighbor_colors[u * (M + 1) + colors[v]]--;
+            neighbor_colors[u * (M + 1) + color]++;
+        }
+        colors[v] = color;
+        refresh(v);
+        for (int u : neighbors[v]) refresh(u);
+    }
+
+private:
+    int count(int v, int c) const { return neighbor_colors[v * (M + 1) + c]; }
+
+    // Mantiene v dentro o fuera del conjunto de vértices en conflicto.
+    void refresh(int v) {
+        bool in_conflict = count(v, colors[v]) > 0;
+        if (in_conflict && slot[v] < 0) {
+            slot[v] = (int)clashing.size();
+            clashing.push_back(v);
+        } else if (!in_conflict && slot[v] >= 0) {
+            int last = clashing.back();
+            clashing[slot[v]] = last;
+            slot[last] = slot[v];
+            clashing.pop_back();
+            slot[v] = -1;
+        }
+    }
+
+    int V, M;
+    vector<vector<int>> neighbors;
+    ColorAssignment colors;       // Colores 1..M
+    vector<int> neighbor_colors;  // [v * (M + 1) + c] = vecinos de v con color c
+    vector<int> clashing;         // Vértices con algún vecino del mismo color
+    vector<int> slot;             // Posición de cada vértice en "clashing" (-1 = fuera)
+    long long conflicts = 0;
+};
+
+// Búsqueda Tabú - Mejor recoloreo no tabú de los vértices en conflicto (TabuCol), con aspiración
+Result run_tabu_search_coloring(int V, int M, const Graph& graph) {
+    auto start_time = high_resolution_clock::now();
+    AnytimeProfile profile; // Mejor objetivo vs. tiempo
+    SaRng rng(std::chrono::system_clock::now().time_since_epoch().count());
+    ColoringTabu problem(graph, V, M, rng);
+    TabuOptions options;
+    options.max_iterations = max(200000LL, 2000LL * V);
+    options.tenure = TabuTenure{0, 10, 0.6}; // Tenencia clásica de TabuCol: aleatorio(10) + 0.6 * conflictos
+    options.seed = rng.next();
+    TabuStats stats = tabu_search(problem, options, &profile);
+    auto end_time = high_resolution_clock::now();
+    Result result = {"Búsqueda Tabú (Aspiración)", duration_cast<microseconds>(end_time - start_time).count() / 1000.0, stats.found, stats.iterations};
+    result.profile = profile.to_string();
+    return result;
+}
+
+// Modo portafolio (portfolio.h): corre en paralelo los algoritmos cancelables; el primero que resuelve cancela al resto.
+void run_portfolio_coloring(int V, int M, const Graph& graph) {
+    int threads = portfolio_threads_per_entry(5);
+    vector<PortfolioEntry> entries;
+    if (V <= 16 && M <= 15) {
+        entries.push_back({"HDA* (A* Paralelo)", [&](const StopToken &token) {
+            CancellableProblem<ColoringProblem> problem(ColoringProblem{graph, V, M}, token);
+            SearchStats stats = hda_star(problem, threads, 50000);
+            return PortfolioOutcome{stats.found, stats.expanded};
+        }});
+        entries.push_back({"BFS Externo (Frontera en Disco)", [&](const StopToken &token) {
+            CancellableProblem<ColoringProblem> problem(ColoringProblem{graph, V, M}, token);
+            SpillStats stats = spill_search(problem, 1 << 20, false);
+            return PortfolioOutcome{stats.found, stats.expanded};
+        }});
+        entries.push_back({"BFS Paralelo (Por Niveles)", [&](const StopToken &token) {
+            CancellableProblem<ColoringProblem> problem(ColoringProblem{graph, V, M}, token);
+            ParallelBfsStats stats = parallel_bfs(problem, threads, 50000, CheckpointConfig());
+            return PortfolioOutcome{stats.found, stats.expanded};
+        }});
+    }
+    entries.push_back({"Recocido Simulado (Delta O(1))", [&](const StopToken &token) {
+        SaRng rng(std::chrono::system_clock::now().time_since_epoch().count());
+        ColoringAnnealing problem(graph, V, M, rng);
+        SaOptions options;
+        options.max_iterations = max(200000LL, 2000LL * V);
+        options.reheat_after = max(2000LL, 50LL * V);
+        options.seed = rng.next();
+        options.stop = token.flag();
+        SaStats stats = simulated_annealing(problem, GeometricCooling{0.6, 0.99999}, options);
+        return PortfolioOutcome{stats.found, stats.iterations};
+    }});
+    entries.push_back({"Búsqueda Tabú (Aspiración)", [&](const StopToken &token) {
+        SaRng rng(std::chrono::system_clock::now().time_since_epoch().count());
+        ColoringTabu problem(graph, V, M, rng);
+        TabuOptions options;
+        options.max_iterations = max(200000LL, 2000LL * V);
+        options.tenure = TabuTenure{0, 10, 0.6};
+        options.seed = rng.next();
+        options.stop = token.flag();
+        TabuStats stats = tabu_search(problem, options);
+        return PortfolioOutcome{stats.found, stats.iterations};
+    }});
+    print_portfolio(run_portfolio(entries));
+}
+
+// Modo lockstep: todos los motores avanzan por turnos en un hilo con el mismo cuanto
+void run_lockstep_coloring(int V, int M, const Graph& graph, long long quantum) {
+    ColoringProblem problem{graph, V, M};
+    InternedProblem<ColoringProblem> shared(problem); // A* y BFS comparten estados, h y sucesores
+    SaRng rng(std::chrono::system_clock::now().time_since_epoch().count());
+    ColoringAnnealing annealing(graph, V, M, rng);
+    SaOptions options;
+    options.max_iterations = max(200000LL, 2000LL * V);
+    options.reheat_after = max(2000LL, 50LL * V);
+    options.seed = rng.next();
+    ColoringTabu tabu_problem(graph, V, M, rng);
+    TabuOptions tabu;
+    tabu.max_iterations = max(200000LL, 2000LL * V);
+    tabu.tenure = TabuTenure{0, 10, 0.6};
+    tabu.seed = rng.next();
+
+    vector<LockstepEntry> entries;
+    if (V <= 16 && M <= 15) {
+        entries.push_back(make_lockstep_entry("A* (Por Pasos)", make_shared<AStarStepper<InternedProblem<ColoringProblem>>>(shared)));
+        entries.push_back(make_lockstep_entry("BFS (Por Pasos)", make_shared<BfsStepper<InternedProblem<ColoringProblem>>>(shared)));
+    }
+    entries.push_back(make_lockstep_entry("Recocido Simulado (Delta O(1))",
+        make_shared<SaStepper<ColoringAnnealing, GeometricCooling>>(annealing, GeometricCooling{0.6, 0.99999}, options)));
+    entries.push_back(make_lockstep_entry("Búsqueda Tabú (Aspiración)", make_shared<TabuStepper<ColoringTabu>>(tabu_problem, tabu)));
+    print_lockstep(run_lockstep(entries, quantum, options.max_iterations));
+    print_intern_stats(shared.stats());
 }
 
 int main() {
     const int V = 5; const int M = 5; 
     const Graph graph = { {0, 1, 1, 1, 1}, {1, 0, 1, 1, 1}, {1, 1, 0, 1, 1}, {1, 1, 1, 0, 1}, {1, 1, 1, 1, 0} };
     
+    // Modo portafolio (SEARCH_PORTFOLIO=1): la primera solución válida gana
+    if (portfolio_mode()) {
+        run_portfolio_coloring(V, M, graph);
+        return 0;
+    }
+
+    // Modo lockstep (SEARCH_LOCKSTEP=<cuanto>): mismo presupuesto de trabajo para todos
+    if (lockstep_quantum() > 0) {
+        run_lockstep_coloring(V, M, graph, lockstep_quantum());
+        return 0;
+    }
+
     vector<Result> results;
     results.push_back(run_backtracking(V, M, graph)); 
     results.push_back(run_bfs_coloring(V, M, graph));
     results.push_back(run_a_star_coloring(V, M, graph)); 
     results.push_back(run_hill_climbing_coloring(V, M, graph));
+    results.push_back(run_hda_star_coloring(V, M, graph));
+    results.push_back(run_spill_bfs_coloring(V, M, graph));
+    results.push_back(run_parallel_bfs_coloring(V, M, graph));
+    results.push_back(run_approx_bfs_coloring(V, M, graph));
+    results.push_back(run_simulated_annealing_coloring(V, M, graph));
+    results.push_back(run_tabu_search_coloring(V, M, graph));
 
     Result optimal_result = {"", numeric_limits<double>::max(), false};
     for (const auto& res : results) { if (res.found && res.duration_ms < optimal_result.duration_ms) optimal_result = res; }
 
+    // Curvas calidad vs. tiempo (búsqueda local / anytime)
+    for (const auto& res : results) {
+        if (!res.profile.empty()) cout << "   ~ " << res.name << ": " << res.profile << endl;
+    }
+
     cout << "\n🏆 ALGORITMO MÁS RÁPIDO PARA COLOREADO DE GRAFOS (V=" << V << ", M=" << M << "):" << endl;
     if (optimal_result.duration_ms != numeric_limits<double>::max()) {
         cout << "   > Algoritmo: " << optimal_result.name << endl;
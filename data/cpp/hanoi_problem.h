@@ -0,0 +1,147 @@
+// --- Torres de Hanói para el núcleo de búsqueda genérico (search_core.h) ---
+//
+// Estado empaquetado en 64 bits (2 bits por disco = su poste) y heurística de
+// bases de patrones aditivas. Lo comparten los cuatro archivos Hanoi_* y las
+// pruebas de data/cpp/tests.
+//
+// La base de patrones guarda distancias exactas de PDB_DISKS discos. Con 3
+// postes y 8 discos la distancia máxima es 2^8 - 1 = 255: cabe en un byte,
+// pero ya no queda ningún valor libre para marcar "sin visitar", así que el
+// BFS de construcción lleva las visitas en un mapa de bits aparte.
+
+#ifndef HANOI_PROBLEM_H
+#define HANOI_PROBLEM_H
+
+#include "checkpoint.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Hanói con estado empaquetado: 2 bits por disco guardan su poste (máx. 4 postes, 32 discos).
+ * Los bits [2d, 2d+1] indican el poste del disco d+1 (d=0 es el más pequeño).
+ */
+struct HanoiProblem {
+    using State = uint64_t;
+    struct Move { int disk, from, to; };
+    static const int MAX_MOVES = 12;  // 4 postes * 3 destinos
+    static const int PDB_DISKS = 8;   // Discos por bloque de la base de patrones (4^8 = 64 KB)
+
+    int pegs, disks;
+    State goal;
+    std::vector<uint8_t> pdb; // pdb[estado de PDB_DISKS discos] = movimientos exactos hasta el poste destino
+
+    HanoiProblem(int N, int M) : pegs(N), disks(M), goal(0) {
+        for (int d = 0; d < M; d++) goal |= (State)(N - 1) << (2 * d);
+        build_pdb();
+    }
+
+    State initial() const { return 0; } // Todos los discos en el poste 0
+    bool is_goal(const State &s) const { return s == goal; }
+    int peg_of(const State &s, int d) const { return (int)((s >> (2 * d)) & 3); }
+    uint64_t hash(const State &s) const { return s; }
+    // Parámetros de la instancia para la huella de los checkpoints (checkpoint.h).
+    uint64_t fingerprint() const { return checkpoint_hash({(uint64_t)pegs, (uint64_t)disks}); }
+
+    /**
+     * @brief Heurística aditiva de bases de patrones: los discos se agrupan en bloques de
+     * PDB_DISKS (desde el más grande) y se suma la distancia exacta de cada bloque ignorando
+     * los demás. Cada movimiento mueve un solo disco, así que la suma es admisible.
+     */
+    int heuristic(const State &s) const {
+        int h = 0;
+        for (int hi = disks; hi > 0; hi -= PDB_DISKS) {
+            int lo = std::max(0, hi - PDB_DISKS);
+            int k = hi - lo;
+            State block = (s >> (2 * lo)) & (((State)1 << (2 * k)) - 1);
+            // Los discos que faltan en un bloque incompleto se consideran ya en el destino.
+            block |= pdb_goal & ~(((State)1 << (2 * k)) - 1);
+            h += pdb[block];
+        }
+        return h;
+    }
+
+    template <class Visit>
+    void expand(const State &s, Visit &&visit) const {
+        for_each_move(s, disks, [&](int disk, int /*from*/, int to) { visit(moved(s, disk, to), 1); });
+    }
+
+    // Interfaz de movimientos en el sitio (IDA*): aplicar y deshacer sin copiar el estado.
+    int moves(const State &s, Move *out) const {
+        int n = 0;
+        for_each_move(s, disks, [&](int disk, int from, int to) { out[n++] = {disk, from, to}; });
+        return n;
+    }
+    void apply(State &s, const Move &m) const { s = moved(s, m.disk, m.to); }
+    void undo(State &s, const Move &m) const { s = moved(s, m.disk, m.from); }
+
+    // Interfaz bidireccional: objetivo explícito y predecesores (los movimientos son reversibles).
+    State goal_state() const { return goal; }
+    template <class Visit>
+    void expand_reverse(const State &s, Visit &&visit) const { expand(s, visit); }
+
+    // Representación legible: discos de cada poste de abajo hacia arriba, p. ej. "[3 2] [1] [] []".
+    std::string describe(const State &s) const {
+        std::string out;
+        for (int p = 0; p < pegs; p++) {
+            out += (p ? " [" : "[");
+            bool first = true;
+            for (int d = disks - 1; d >= 0; d--) {
+                if (peg_of(s, d) != p) continue;
+                out += (first ? "" : " ") + std::to_string(d + 1);
+                first = false;
+            }
+            out += "]";
+        }
+        return out;
+    }
+
+private:
+    State pdb_goal = 0;
+
+    static State moved(State s, int disk, int to) {
+        return (s & ~((State)3 << (2 * disk))) | ((State)to << (2 * disk));
+    }
+
+    template <class F>
+    void for_each_move(const State &s, int n, F &&f) const {
+        int top[4] = {-1, -1, -1, -1}; // Disco en la cima de cada poste
+        for (int d = n - 1; d >= 0; d--) top[peg_of(s, d)] = d;
+        for (int from = 0; from < pegs; from++) {
+            if (top[from] < 0) continue;
+            int disk = top[from];
+            for (int to = 0; to < pegs; to++) {
+                if (to == from) continue;
+                // Movimiento válido: el poste destino está vacío o su cima es más grande
+                if (top[to] < 0 || top[to] > disk) f(disk, from, to);
+            }
+        }
+    }
+
+    // BFS hacia atrás desde el objetivo en el espacio abstracto de PDB_DISKS discos.
+    // Las visitas van en un mapa de bits: 255 es una distancia real (3 postes).
+    void build_pdb() {
+        for (int d = 0; d < PDB_DISKS; d++) pdb_goal |= (State)(pegs - 1) << (2 * d);
+        const size_t size = (size_t)1 << (2 * PDB_DISKS);
+        pdb.assign(size, 0);
+        std::vector<uint64_t> seen((size + 63) / 64, 0);
+        seen[pdb_goal >> 6] |= 1ULL << (pdb_goal & 63);
+        std::vector<State> frontier = {pdb_goal};
+        for (size_t i = 0; i < frontier.size(); i++) {
+            State cur = frontier[i];
+            for_each_move(cur, PDB_DISKS, [&](int disk, int /*from*/, int to) {
+                State next = moved(cur, disk, to);
+                uint64_t bit = 1ULL << (next & 63);
+                if ((seen[next >> 6] & bit) == 0) {
+                    seen[next >> 6] |= bit;
+                    pdb[next] = (uint8_t)(pdb[cur] + 1);
+                    frontier.push_back(next);
+                }
+            });
+        }
+    }
+};
+
+#endif // HANOI_PROBLEM_H
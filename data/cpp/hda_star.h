@@ -0,0 +1,215 @@
+// --- HDA*: A* paralelo distribuido por hash ---
+//
+// Cada estado tiene un hilo "dueño" (hash(s) % hilos). Solo el dueño guarda el
+// estado en su lista abierta/cerrada, así que las tablas son locales y no
+// necesitan cerrojos. Los sucesores de otro dueño se acumulan en lotes y se
+// envían a su buzón, una pila sin bloqueo (CAS sobre la cabeza).
+//
+// Terminación: un contador atómico "work" = hilos activos + lotes en vuelo.
+// Un hilo se desactiva cuando su mejor f no puede mejorar la solución actual;
+// al llegar a 0 nadie puede volver a generar trabajo y la solución es óptima
+// (con heurística admisible).
+
+#ifndef HDA_STAR_H
+#define HDA_STAR_H
+
+#include "search_core.h"
+
+#include <atomic>
+#include <thread>
+#include <queue>
+#include <vector>
+#include <algorithm>
+
+template <class State>
+struct HdaNode {
+    State state;
+    int g;
+    int f;
+    // Min-heap por f; a igual f se prefiere el nodo más profundo.
+    bool operator>(const HdaNode &other) const {
+        if (f != other.f) return f > other.f;
+        return g < other.g;
+    }
+};
+
+// Lote de nodos enviado de un hilo a otro.
+template <class State>
+struct HdaBatch {
+    HdaBatch *next = nullptr;
+    std::vector<HdaNode<State>> nodes;
+};
+
+// Buzón sin bloqueo: múltiples productores, un solo consumidor (el dueño).
+template <class State>
+class HdaMailbox {
+public:
+    void push(HdaBatch<State> *batch) {
+        HdaBatch<State> *head = head_.load(std::memory_order_relaxed);
+        do {
+            batch->next = head;
+        } while (!head_.compare_exchange_weak(head, batch, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // Extrae todos los lotes pendientes de una sola vez.
+    HdaBatch<State> *take_all() { return head_.exchange(nullptr, std::memory_order_acquire); }
+
+private:
+    std::atomic<HdaBatch<State> *> head_{nullptr};
+};
+
+/**
+ * @brief A* paralelo con distribución por hash (HDA*).
+ * @param problem Problema con la interfaz descrita en search_core.h.
+ * @param num_threads Número de hilos (0 = todos los núcleos disponibles).
+ * @param max_nodes Límite global de expansiones (como MAX_NODES en las versiones secuenciales).
+ * @return Estadísticas; cost es óptimo si found && !truncated.
+ */
+template <class P>
+SearchStats hda_star(const P &problem, int num_threads = 0, long long max_nodes = 1000000) {
+    using State = typename P::State;
+    using Node = HdaNode<State>;
+    using Batch = HdaBatch<State>;
+    const size_t BATCH_SIZE = 64;
+
+    if (num_threads <= 0) num_threads = (int)std::max(1u, std::thread::hardware_concurrency());
+    const int T = num_threads;
+    ProblemHasher<P> hasher{&problem};
+
+    std::vector<HdaMailbox<State>> mailboxes(T);
+    std::atomic<int> incumbent{SEARCH_INF};
+    std::atomic<long long> work{T};
+    std::atomic<long long> total_expanded{0};
+    std::atomic<bool> out_of_budget{false};
+    std::vector<long long> expanded(T, 0), generated(T, 0);
+
+    auto owner = [&](const State &s) { return (int)((hasher(s) >> 32) % (uint64_t)T); };
+
+    auto worker = [&](int id) {
+        std::priority_queue<Node, std::vector<Node>, std::greater<Node>> open;
+        StateTable<State, int, ProblemHasher<P>> closed(hasher);  // mejor g conocido
+        std::vector<std::vector<Node>> outbox(T);
+        bool active = true;
+        long long pending_expanded = 0;
+
+        auto add_local = [&](const Node &n) {
+            auto ins = closed.insert(n.state, n.g);
+            if (!ins.second) {
+                if (*ins.first <= n.g) return;
+                *ins.first = n.g;
+            }
+            open.push(n);
+        };
+        auto flush = [&](int dest) {
+            if (outbox[dest].empty()) return;
+            Batch *b = new Batch;
+            b->nodes.swap(outbox[dest]);
+            work.fetch_add(1);  // el lote cuenta como trabajo hasta que se consuma
+            mailboxes[dest].push(b);
+        };
+
+        State start = problem.initial();
+        if (owner(start) == id) {
+            int h = problem.heuristic(start);
+            if (h < SEARCH_INF) add_local({start, 0, h});
+        }
+
+        while (!out_of_budget.load(std::memory_order_relaxed)) {
+            // 1. Recibir nodos de otros hilos.
+            for (Batch *b = mailboxes[id].take_all(); b != nullptr;) {
+                if (!active) {
+                    work.fetch_add(1);  // reactivarse ANTES de descontar el lote
+                    active = true;
+                }
+                for (const Node &n : b->nodes) add_local(n);
+                Batch *next = b->next;
+                delete b;
+                work.fetch_sub(1);
+                b = next;
+            }
+
+            // 2. Expandir un bloque de nodos locales.
+            int best = incumbent.load(std::memory_order_relaxed);
+            for (int steps = 0; steps < 64 && !open.empty(); ++steps) {
+                Node cur = open.top();
+                if (cur.f >= best) break;
+                open.pop();
+                if (*closed.find(cur.state) < cur.g) continue;  // entrada obsoleta
+                expanded[id]++;
+                pending_expanded++;
+                SEARCH_TRACE(TRACE_EXPAND, hasher(cur.state), cur.g, cur.g, cur.f - cur.g);
+
+                if (problem.is_goal(cur.state)) {
+                    SEARCH_TRACE(TRACE_GOAL, hasher(cur.state), cur.g, cur.g, 0);
+                    int prev = incumbent.load();
+                    while (cur.g < prev && !incumbent.compare_exchange_weak(prev, cur.g)) {}
+                    best = incumbent.load();
+                    continue;
+                }
+
+                problem.expand(cur.state, [&](const State &next, int step_cost) {
+                    generated[id]++;
+                    int h = problem.heuristic(next);
+                    if (h >= SEARCH_INF || cur.g + step_cost + h >= best) {
+                        SEARCH_TRACE(TRACE_PRUNE, hasher(next), cur.g + step_cost, cur.g + step_cost, h);
+                        return;
+                    }
+                    Node child{next, cur.g + step_cost, cur.g + step_cost + h};
+                    SEARCH_TRACE(TRACE_GENERATE, hasher(next), child.g, child.g, h);
+                    int dest = owner(next);
+                    if (dest == id) {
+                        add_local(child);
+                    } else {
+                        outbox[dest].push_back(child);
+                        if (outbox[dest].size() >= BATCH_SIZE) flush(dest);
+                    }
+                });
+            }
+            if (pending_expanded >= 256) {
+                if (total_expanded.fetch_add(pending_expanded) + pending_expanded > max_nodes)
+                    out_of_budget.store(true);
+                pending_expanded = 0;
+            }
+
+            // 3. ¿Queda trabajo útil en este hilo?
+            bool useful = !open.empty() && open.top().f < incumbent.load();
+            if (!useful) {
+                for (int d = 0; d < T; ++d) flush(d);
+                if (active) {
+                    active = false;
+                    work.fetch_sub(1);
+                }
+                if (work.load() == 0) break;  // nadie activo y ningún lote en vuelo
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < T; ++i) threads.emplace_back(worker, i);
+    worker(0);
+    for (auto &t : threads) t.join();
+
+    // Liberar lotes que quedaron sin consumir si se agotó el presupuesto.
+    for (auto &mb : mailboxes) {
+        for (Batch *b = mb.take_all(); b != nullptr;) {
+            Batch *next = b->next;
+            delete b;
+            b = next;
+        }
+    }
+
+    SearchStats stats;
+    for (int i = 0; i < T; ++i) {
+        stats.expanded += expanded[i];
+        stats.generated += generated[i];
+    }
+    stats.truncated = out_of_budget.load();
+    if (incumbent.load() < SEARCH_INF) {
+        stats.found = true;
+        stats.cost = incumbent.load();
+    }
+    return stats;
+}
+
+#endif // HDA_STAR_H
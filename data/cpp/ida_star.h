@@ -0,0 +1,177 @@
+// --- IDA*: A* por profundización iterativa con memoria O(profundidad) ---
+//
+// Además de la interfaz de search_core.h, el problema debe ofrecer movimientos
+// que se aplican y deshacen sobre el mismo estado (sin copias):
+//
+//   using Move = ...;
+//   static const int MAX_MOVES = ...;                 // cota de movimientos por estado
+//   int moves(const State &s, Move *out) const;      // escribe los movimientos legales, devuelve cuántos
+//   void apply(State &s, const Move &m) const;
+//   void undo(State &s, const Move &m) const;
+//
+// Todos los movimientos tienen costo 1. Opcionalmente se usa una tabla de
+// transposición de tamaño fijo (mapeo directo) que guarda, para cada estado
+// ya refutado, la cota aprendida h' = (menor f que superó el umbral) - g.
+// Al volver a alcanzarlo (transposición o siguiente iteración) se usa
+// max(h, h'), que sigue siendo admisible y poda el subárbol repetido.
+
+#ifndef IDA_STAR_H
+#define IDA_STAR_H
+
+#include "search_core.h"
+
+#include <vector>
+#include <algorithm>
+
+// Estadísticas de IDA*: las comunes más el detalle por iteración y de la tabla.
+struct IdaStats : SearchStats {
+    int iterations = 0;
+    std::vector<long long> nodes_per_iteration;
+    long long tt_probes = 0;
+    long long tt_hits = 0;
+
+    double tt_hit_rate() const { return tt_probes ? (double)tt_hits / tt_probes : 0.0; }
+};
+
+template <class P>
+class IdaStarSearch {
+public:
+    using State = typename P::State;
+    using Move = typename P::Move;
+
+    /**
+     * @param tt_entries Entradas de la tabla de transposición (0 = sin tabla); se redondea a potencia de 2.
+     * @param max_nodes Límite total de expansiones sumando todas las iteraciones.
+     */
+    IdaStarSearch(const P &problem, size_t tt_entries, long long max_nodes)
+        : problem_(problem), hasher_{&problem}, max_nodes_(max_nodes) {
+        if (tt_entries > 0) {
+            size_t cap = 1;
+            while (cap < tt_entries) cap <<= 1;
+            tt_.resize(cap);
+        }
+    }
+
+    IdaStats run() {
+        State s = problem_.initial();
+        int threshold = problem_.heuristic(s);
+        while (threshold < SEARCH_INF) {
+            stats_.iterations++;
+            iteration_nodes_ = 0;
+            int next = search(s, 0, threshold, 0);
+            stats_.nodes_per_iteration.push_back(iteration_nodes_);
+            if (stats_.found) {
+                stats_.cost = threshold;
+                break;
+            }
+            if (stats_.truncated) break;
+            threshold = next;
+        }
+        return stats_;
+    }
+
+private:
+    struct TTEntry {
+        State key;
+        int h = 0;         // Cota inferior aprendida del costo restante
+        bool used = false;
+    };
+
+    // Devuelve el menor f que superó el umbral (SEARCH_INF si no hay).
+    int search(State &s, int g, int threshold, int depth) {
+        int h = problem_.heuristic(s);
+        if (h >= SEARCH_INF) {
+            SEARCH_TRACE(TRACE_PRUNE, hasher_(s), depth, g, -1);
+            return SEARCH_INF;
+        }
+        int f = g + h;
+        if (f > threshold) {
+            SEARCH_TRACE(TRACE_PRUNE, hasher_(s), depth, g, h);
+            return f;
+        }
+
+        TTEntry *entry = nullptr;
+        if (!tt_.empty()) {
+            stats_.tt_probes++;
+            entry = &tt_[hasher_(s) & (tt_.size() - 1)];
+            if (entry->used && entry->key == s) {
+                stats_.tt_hits++;
+                h = std::max(h, entry->h);
+                f = g + h;
+                if (f > threshold) { // Transposición ya refutada con este umbral
+                    SEARCH_TRACE(TRACE_PRUNE, hasher_(s), depth, g, h);
+                    return f;
+                }
+            }
+        }
+
+        stats_.expanded++;
+        iteration_nodes_++;
+        SEARCH_TRACE(TRACE_EXPAND, hasher_(s), depth, g, h);
+        if (stats_.expanded > max_nodes_) {
+            stats_.truncated = true;
+            return SEARCH_INF;
+        }
+        if (problem_.is_goal(s)) {
+            SEARCH_TRACE(TRACE_GOAL, hasher_(s), depth, g, 0);
+            stats_.found = true;
+            return f;
+        }
+
+        // Búfer de movimientos por nivel: memoria O(profundidad * MAX_MOVES).
+        if ((size_t)(depth + 1) * P::MAX_MOVES > move_buffer_.size())
+            move_buffer_.resize((size_t)(depth + 1) * P::MAX_MOVES * 2);
+        if ((size_t)depth + 1 > path_.size()) path_.resize(depth + 1);
+        path_[depth] = s;
+
+        int count = problem_.moves(s, &move_buffer_[(size_t)depth * P::MAX_MOVES]);
+        int min_exceeded = SEARCH_INF;
+        for (int i = 0; i < count; ++i) {
+            Move m = move_buffer_[(size_t)depth * P::MAX_MOVES + i];
+            problem_.apply(s, m);
+            stats_.generated++;
+            SEARCH_TRACE(TRACE_GENERATE, hasher_(s), depth + 1, g + 1, -1);
+            // Poda del padre (solo sin tabla): con tabla se exploran todos los hijos para
+            // que la cota aprendida siga siendo admisible.
+            if (!tt_.empty() || depth == 0 || !(s == path_[depth - 1])) {
+                int t = search(s, g + 1, threshold, depth + 1);
+                if (stats_.found || stats_.truncated) {
+                    problem_.undo(s, m);
+                    return t;
+                }
+                min_exceeded = std::min(min_exceeded, t);
+            }
+            problem_.undo(s, m);
+            SEARCH_TRACE(TRACE_BACKTRACK, hasher_(s), depth, g, h);
+        }
+        // Guardar la cota aprendida: ningún camino desde s cuesta menos que min_exceeded - g.
+        if (entry != nullptr && min_exceeded < SEARCH_INF) {
+            entry->key = s;
+            entry->h = min_exceeded - g;
+            entry->used = true;
+        }
+        return min_exceeded;
+    }
+
+    const P &problem_;
+    ProblemHasher<P> hasher_;
+    long long max_nodes_;
+    IdaStats stats_;
+    long long iteration_nodes_ = 0;
+    std::vector<TTEntry> tt_;
+    std::vector<Move> move_buffer_;
+    std::vector<State> path_;
+};
+
+/**
+ * @brief IDA* con tabla de transposición opcional de tamaño fijo.
+ * @param tt_entries Entradas de la tabla (0 = IDA* puro, memoria O(profundidad)).
+ * @param max_nodes Límite total de expansiones.
+ */
+template <class P>
+IdaStats ida_star(const P &problem, size_t tt_entries = 1 << 20, long long max_nodes = 50000000) {
+    IdaStarSearch<P> search(problem, tt_entries, max_nodes);
+    return search.run();
+}
+
+#endif // IDA_STAR_H
@@ -0,0 +1,188 @@
+// --- Backtracking de N-Reinas con máscaras de bits (N <= 64) ---
+//
+// En lugar de revisar las filas anteriores en cada intento (is_safe es O(fila)),
+// el estado de una rama son tres palabras de 64 bits: columnas ocupadas y
+// casillas atacadas por las dos diagonales en la fila actual. Las casillas
+// libres son full & ~(cols | ld | rd); se toma el bit más bajo con
+// libres & -libres, y al bajar de fila las diagonales se desplazan un bit.
+// No hay vector de solución parcial ni push_back/pop_back: la rama vive en la
+// pila de llamadas como tres enteros.
+
+#ifndef NQUEENS_BITBOARD_H
+#define NQUEENS_BITBOARD_H
+
+#include <cstdint>
+#include <vector>
+
+struct BitboardStats {
+    long long solutions = 0;  // Soluciones contadas (o 1 si se buscaba la primera)
+    long long nodes = 0;      // Reinas colocadas (nodos del árbol visitados)
+};
+
+// Máscara con los N bits bajos encendidos (una columna por bit).
+inline uint64_t nqueens_full_mask(int N) {
+    return N >= 64 ? ~0ULL : (1ULL << N) - 1;
+}
+
+/**
+ * @brief Cuenta las soluciones del subárbol con columnas y diagonales ya ocupadas.
+ * @param full Máscara de columnas del tablero (nqueens_full_mask).
+ * @param cols Columnas ocupadas; ld / rd: casillas atacadas por diagonal en la fila actual.
+ */
+inline long long nqueens_count_from(uint64_t full, uint64_t cols, uint64_t ld, uint64_t rd, long long &nodes) {
+    if (cols == full) return 1;
+    long long count = 0;
+    uint64_t free = full & ~(cols | ld | rd);
+    while (free != 0) {
+        uint64_t bit = free & (0 - free); // Bit libre más bajo
+        free ^= bit;
+        nodes++;
+        count += nqueens_count_from(full, cols | bit, ((ld | bit) << 1) & full, (rd | bit) >> 1, nodes);
+    }
+    return count;
+}
+
+/**
+ * @brief Cuenta todas las soluciones de N-Reinas (1 <= N <= 64).
+ */
+inline BitboardStats nqueens_bitboard_count(int N) {
+    BitboardStats stats;
+    if (N < 1 || N > 64) return stats;
+    stats.solutions = nqueens_count_from(nqueens_full_mask(N), 0, 0, 0, stats.nodes);
+    return stats;
+}
+
+// Primera solución en orden lexicográfico de columnas; columns[row] = columna.
+inline bool nqueens_first_from(uint64_t full, uint64_t cols, uint64_t ld, uint64_t rd, std::vector<int> &columns,
+                               long long &nodes) {
+    if (cols == full) return true;
+    uint64_t free = full & ~(cols | ld | rd);
+    while (free != 0) {
+        uint64_t bit = free & (0 - free);
+        free ^= bit;
+        nodes++;
+        columns[__builtin_popcountll(cols)] = __builtin_ctzll(bit); // Fila = reinas ya colocadas
+        if (nqueens_first_from(full, cols | bit, ((ld | bit) << 1) & full, (rd | bit) >> 1, columns, nodes)) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Busca la primera solución de N-Reinas (1 <= N <= 64).
+ * @param columns Salida: columna de la reina de cada fila (vacío si no hay solución).
+ */
+inline BitboardStats nqueens_bitboard_first(int N, std::vector<int> &columns) {
+    BitboardStats stats;
+    columns.clear();
+    if (N < 1 || N > 64) return stats;
+    columns.assign(N, -1);
+    if (nqueens_first_from(nqueens_full_mask(N), 0, 0, 0, columns, stats.nodes)) stats.solutions = 1;
+    else columns.clear();
+    return stats;
+}
+
+// --- Conteo con simetrías ---
+//
+// Reflejo: toda solución con la reina de la primera fila en la mitad derecha es
+// el espejo de una con la reina en la mitad izquierda. Basta recorrer la mitad
+// izquierda y contar doble (más la columna central una vez si N es impar):
+// la mitad del trabajo.
+//
+// Soluciones fundamentales: cada clase bajo las 8 simetrías del tablero
+// (rotaciones y reflejos) se cuenta una vez, en su forma canónica (la menor
+// lexicográficamente de sus 8 transformaciones). La forma canónica siempre
+// cae en la mitad recorrida (el espejo de una primera columna c es N-1-c), así
+// que basta revisar las soluciones de esa mitad.
+
+struct SymmetryStats {
+    long long total = 0;       // Todas las soluciones (con pesos de reflejo)
+    long long unique = 0;      // Soluciones fundamentales (una por clase de simetría)
+    long long nodes = 0;       // Reinas colocadas
+    long long enumerated = 0;  // Soluciones visitadas (= comprobaciones de forma canónica)
+};
+
+/**
+ * @brief Cuenta todas las soluciones recorriendo solo la mitad izquierda de la primera fila.
+ */
+inline BitboardStats nqueens_count_mirror(int N) {
+    BitboardStats stats;
+    if (N < 1 || N > 64) return stats;
+    const uint64_t full = nqueens_full_mask(N);
+    for (int col = 0; col < (N + 1) / 2; ++col) {
+        uint64_t bit = 1ULL << col;
+        stats.nodes++;
+        long long count = nqueens_count_from(full, bit, (bit << 1) & full, bit >> 1, stats.nodes);
+        stats.solutions += (N % 2 == 1 && col == N / 2) ? count : 2 * count; // Columna central: su espejo es ella misma
+    }
+    return stats;
+}
+
+/**
+ * @brief Comprueba si una solución es la forma canónica de su clase.
+ * @param columns columns[fila] = columna de una solución completa.
+ * @return Simetrías que la dejan igual (1, 2, 4 u 8) si es canónica; 0 si alguna transformación es menor.
+ */
+inline int nqueens_canonical_symmetries(const std::vector<int> &columns, std::vector<int> &scratch) {
+    const int N = (int)columns.size();
+    scratch.resize(N);
+    int fixed = 1; // La identidad
+    for (int t = 1; t < 8; ++t) {
+        // Imagen de la reina (r, c) bajo la transformación t
+        for (int r = 0; r < N; ++r) {
+            int c = columns[r];
+            switch (t) {
+                case 1: scratch[c] = N - 1 - r; break;          // Rotación 90°
+                case 2: scratch[N - 1 - r] = N - 1 - c; break;  // Rotación 180°
+                case 3: scratch[N - 1 - c] = r; break;          // Rotación 270°
+                case 4: scratch[r] = N - 1 - c; break;          // Reflejo horizontal
+                case 5: scratch[N - 1 - r] = c; break;          // Reflejo vertical
+                case 6: scratch[c] = r; break;                  // Diagonal principal
+                default: scratch[N - 1 - c] = N - 1 - r; break; // Antidiagonal
+            }
+        }
+        int cmp = 0;
+        for (int r = 0; r < N && cmp == 0; ++r) cmp = scratch[r] < columns[r] ? -1 : (scratch[r] > columns[r] ? 1 : 0);
+        if (cmp < 0) return 0;
+        if (cmp == 0) fixed++;
+    }
+    return fixed;
+}
+
+inline void nqueens_enumerate_half(uint64_t full, uint64_t cols, uint64_t ld, uint64_t rd, int row,
+                                   std::vector<int> &columns, std::vector<int> &scratch, SymmetryStats &stats) {
+    if (cols == full) {
+        const int N = (int)columns.size();
+        stats.enumerated++;
+        stats.total += (N % 2 == 1 && columns[0] == N / 2) ? 1 : 2;
+        if (nqueens_canonical_symmetries(columns, scratch) > 0) stats.unique++;
+        return;
+    }
+    uint64_t free = full & ~(cols | ld | rd);
+    while (free != 0) {
+        uint64_t bit = free & (0 - free);
+        free ^= bit;
+        stats.nodes++;
+        columns[row] = __builtin_ctzll(bit);
+        nqueens_enumerate_half(full, cols | bit, ((ld | bit) << 1) & full, (rd | bit) >> 1, row + 1, columns, scratch,
+                               stats);
+    }
+}
+
+/**
+ * @brief Cuenta soluciones totales y fundamentales (1 <= N <= 64) recorriendo media primera fila.
+ */
+inline SymmetryStats nqueens_count_symmetric(int N) {
+    SymmetryStats stats;
+    if (N < 1 || N > 64) return stats;
+    const uint64_t full = nqueens_full_mask(N);
+    std::vector<int> columns(N), scratch(N);
+    for (int col = 0; col < (N + 1) / 2; ++col) {
+        uint64_t bit = 1ULL << col;
+        stats.nodes++;
+        columns[0] = col;
+        nqueens_enumerate_half(full, bit, (bit << 1) & full, bit >> 1, 1, columns, scratch, stats);
+    }
+    return stats;
+}
+
+#endif // NQUEENS_BITBOARD_H
@@ -0,0 +1,471 @@
+// --- Completar N-Reinas con reinas ya colocadas (N de cientos) ---
+//
+// Dadas algunas reinas fijas, ¿se puede completar el tablero? Es NP-completo
+// (a diferencia de N-Reinas sin reinas fijas, que siempre tiene solución para
+// N >= 4), así que sirve de prueba de esfuerzo para la búsqueda.
+//
+// El dominio de cada fila es un mapa de bits de N columnas (N / 64 palabras).
+// Colocar una reina borra su columna y sus dos diagonales de las demás filas:
+// a lo sumo tres bits por fila, O(N) por colocación. Cada borrado se apunta
+// en una pila (trail) y retroceder los restaura en orden inverso.
+//
+// Propagación, además de comprobar hacia adelante:
+//   - una fila con una sola columna posible la toma;
+//   - una columna libre que solo cabe en una fila va a esa fila (hay N reinas
+//     y N columnas: toda columna se usa);
+//   - fila sin columnas o columna sin filas = contradicción.
+// Se ramifica por la fila o la columna con menos opciones (vista dual), con
+// empates y orden de valores al azar, y se reinicia según la serie de Luby
+// cuando una corrida acumula demasiados fallos. Una corrida que agota el árbol
+// sin llegar al límite demuestra que no hay solución.
+//
+// nqueens_completion_instance genera instancias: k reinas al azar sin
+// atacarse o, con planted, k filas de una solución completa (siempre tienen
+// solución). Las instancias al azar casi nunca son difíciles: con pocas reinas
+// la propagación completa el tablero casi sin retroceder y pasada la
+// transición a "sin solución" (~0.7N con N = 50, ~0.85N con N = 200) la
+// contradicción aparece enseguida. nqueens_completion_hard_instance barre k
+// entre N/2 y 7N/8, se queda con el k de más fallos medios y sube desde su peor
+// muestra: mueve una reina fija a otra casilla libre y conserva el cambio si el
+// resolvedor falla más (fallos con semillas fijas y un presupuesto acotado;
+// los nodos los domina la propagación y no distinguen una instancia difícil).
+
+#ifndef NQUEENS_COMPLETION_H
+#define NQUEENS_COMPLETION_H
+
+#include "nqueens_min_conflicts.h"
+#include "simulated_annealing.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+
+enum CompletionResult { COMPLETION_FOUND, COMPLETION_NONE, COMPLETION_UNKNOWN };
+
+inline const char *completion_result_name(CompletionResult result) {
+    return result == COMPLETION_FOUND ? "completable" : (result == COMPLETION_NONE ? "sin solución" : "desconocido");
+}
+
+struct QueenPlacement {
+    int row, col;
+};
+
+struct CompletionOptions {
+    long long max_nodes = 0;                 // Límite de nodos (0 = sin límite)
+    long long restart_base = 64;             // Fallos permitidos en la corrida i: restart_base * luby(i)
+    uint64_t seed = 1;
+    const std::atomic<bool> *stop = nullptr; // Cancelación externa, cada 1024 nodos
+};
+
+struct CompletionStats {
+    CompletionResult result = COMPLETION_UNKNOWN;
+    long long nodes = 0;       // Decisiones de búsqueda
+    long long failures = 0;    // Contradicciones encontradas
+    long long restarts = 0;
+    long long propagated = 0;  // Reinas colocadas por propagación (fila o columna única)
+};
+
+// Serie de Luby: 1, 1, 2, 1, 1, 2, 4, 1, 1, 2, ... (i desde 1)
+inline long long luby(long long i) {
+    long long size = 1, power = 1;
+    while (size < i) {
+        size = 2 * size + 1;
+        power *= 2;
+    }
+    while (size != i) {
+        size = (size - 1) / 2;
+        power /= 2;
+        if (i > size) i -= size;
+    }
+    return power;
+}
+
+/**
+ * @brief Completa un tablero de N-Reinas con reinas fijas (dominios en mapas de bits + propagación + reinicios).
+ */
+class NQueensCompletion {
+public:
+    explicit NQueensCompletion(int N)
+        : N_(N), words_((N + 63) / 64), domain_((size_t)N * words_, 0), size_(N, N), count_(N, N), row_col_(N, -1),
+          col_row_(N, -1) {
+        for (int r = 0; r < N; ++r) {
+            for (int c = 0; c < N; ++c) bits(r)[c >> 6] |= 1ULL << (c & 63);
+        }
+    }
+
+    /**
+     * @brief Fija una reina antes de resolver. false si choca con las fijadas (o con lo que estas fuerzan).
+     */
+    bool fix(int row, int col) {
+        if (!consistent_) return false;
+        if (row < 0 || row >= N_ || col < 0 || col >= N_) consistent_ = false;
+        else if (row_col_[row] >= 0) consistent_ = row_col_[row] == col; // Ya la forzó la propagación
+        else consistent_ = has(row, col) && place(row, col) && propagate();
+        return consistent_;
+    }
+
+    /**
+     * @brief Busca una completación.
+     * @param columns Salida: columns[fila] = columna si result == COMPLETION_FOUND.
+     */
+    CompletionStats solve(const CompletionOptions &options, std::vector<int> &columns) {
+        CompletionStats stats;
+        stats.propagated = propagated_;
+        columns.clear();
+        if (!consistent_) {
+            stats.result = COMPLETION_NONE;
+            return stats;
+        }
+        stats_ = &stats;
+        options_ = &options;
+        rng_ = SaRng(options.seed);
+        const Mark root = mark();
+        for (long long run = 1;; ++run) {
+            run_failures_ = 0;
+            failure_limit_ = options.restart_base * luby(run);
+            Outcome outcome = search();
+            if (outcome == FOUND) columns = row_col_;
+            undo(root);
+            if (outcome == FOUND) stats.result = COMPLETION_FOUND;
+            else if (outcome == EXHAUSTED) stats.result = COMPLETION_NONE;
+            else if (outcome == RESTART) {
+                stats.restarts++;
+                continue;
+            }
+            break; // FOUND, EXHAUSTED o STOP (resultado desconocido)
+        }
+        stats.propagated = propagated_;
+        stats_ = nullptr;
+        options_ = nullptr;
+        return stats;
+    }
+
+private:
+    enum Outcome { FOUND, EXHAUSTED, RESTART, STOP };
+    struct Mark {
+        size_t removed, assigned;
+    };
+
+    uint64_t *bits(int r) { return domain_.data() + (size_t)r * words_; }
+    bool has(int r, int c) const { return (domain_[(size_t)r * words_ + (c >> 6)] >> (c & 63)) & 1; }
+
+    Mark mark() const { return {removed_.size(), assigned_.size()}; }
+
+    // Borra la columna c del dominio de la fila r y encola lo que eso fuerza.
+    void remove(int r, int c) {
+        bits(r)[c >> 6] &= ~(1ULL << (c & 63));
+        removed_.push_back(r * N_ + c);
+        if (--size_[r] <= 1 && row_col_[r] < 0) {
+            if (size_[r] == 0) contradiction_ = true;
+            else pending_.push_back(r);
+        }
+        if (--count_[c] <= 1 && col_row_[c] < 0) {
+            if (count_[c] == 0) contradiction_ = true;
+            else pending_.push_back(N_ + c);
+        }
+    }
+
+    // Coloca (r, c): la fila se queda solo con c y las demás filas libres pierden su columna y diagonales.
+    bool place(int r, int c) {
+        row_col_[r] = c;
+        col_row_[c] = r;
+        assigned_.push_back(r);
+        const uint64_t *row = bits(r);
+        for (int w = 0; w < words_; ++w) {
+            for (uint64_t rest = row[w]; rest != 0; rest &= rest - 1) {
+                int other = w * 64 + __builtin_ctzll(rest);
+                if (other != c) remove(r, other);
+            }
+        }
+        for (int q = 0; q < N_; ++q) {
+            if (row_col_[q] >= 0) continue;
+            int d = q > r ? q - r : r - q;
+            if (has(q, c)) remove(q, c);
+            if (c + d < N_ && has(q, c + d)) remove(q, c + d);
+            if (c - d >= 0 && has(q, c - d)) remove(q, c - d);
+        }
+        return !contradiction_;
+    }
+
+    // Aplica filas y columnas con una sola opción hasta el punto fijo o una contradicción.
+    bool propagate() {
+        while (!pending_.empty() && !contradiction_) {
+            int item = pending_.back();
+            pending_.pop_back();
+            if (item < N_) {
+                int r = item;
+                if (row_col_[r] >= 0 || size_[r] != 1) continue;
+                int c = first_column(r);
+                propagated_++;
+                place(r, c);
+            } else {
+                int c = item - N_;
+                if (col_row_[c] >= 0 || count_[c] != 1) continue;
+                int r = 0;
+                while (row_col_[r] >= 0 || !has(r, c)) ++r;
+                propagated_++;
+                place(r, c);
+            }
+        }
+        pending_.clear();
+        return !contradiction_;
+    }
+
+    int first_column(int r) {
+        const uint64_t *row = bits(r);
+        int w = 0;
+        while (row[w] == 0) ++w;
+        return w * 64 + __builtin_ctzll(row[w]);
+    }
+
+    void undo(const Mark &to) {
+        while (removed_.size() > to.removed) {
+            int cell = removed_.back();
+            removed_.pop_back();
+            int r = cell / N_, c = cell % N_;
+            bits(r)[c >> 6] |= 1ULL << (c & 63);
+            size_[r]++;
+            count_[c]++;
+        }
+        while (assigned_.size() > to.assigned) {
+            int r = assigned_.back();
+            assigned_.pop_back();
+            col_row_[row_col_[r]] = -1;
+            row_col_[r] = -1;
+        }
+        contradiction_ = false;
+        pending_.clear();
+    }
+
+    Outcome search() {
+        if (assigned_.size() == (size_t)N_) return FOUND;
+        if ((++stats_->nodes & 1023) == 0 && options_->stop != nullptr && options_->stop->load(std::memory_order_relaxed)) {
+            return STOP;
+        }
+        if (options_->max_nodes > 0 && stats_->nodes >= options_->max_nodes) return STOP;
+
+        // Fila o columna libre con menos opciones; empates al azar.
+        int best = -1, best_size = N_ + 1, ties = 0;
+        for (int i = 0; i < 2 * N_; ++i) {
+            bool is_row = i < N_;
+            if (is_row ? row_col_[i] >= 0 : col_row_[i - N_] >= 0) continue;
+            int width = is_row ? size_[i] : count_[i - N_];
+            if (width < best_size) {
+                best = i;
+                best_size = width;
+                ties = 1;
+            } else if (width == best_size && rng_.below(++ties) == 0) {
+                best = i;
+            }
+        }
+
+        std::vector<QueenPlacement> choices;
+        choices.reserve(best_size);
+        if (best < N_) {
+            for (int c = 0; c < N_; ++c) {
+                if (has(best, c)) choices.push_back({best, c});
+            }
+        } else {
+            for (int r = 0; r < N_; ++r) {
+                if (row_col_[r] < 0 && has(r, best - N_)) choices.push_back({r, best - N_});
+            }
+        }
+        for (size_t k = choices.size(); k > 1; --k) std::swap(choices[k - 1], choices[rng_.below((int)k)]);
+
+        for (const QueenPlacement &choice : choices) {
+            const Mark before = mark();
+            if (place(choice.row, choice.col) && propagate()) {
+                Outcome outcome = search();
+                if (outcome != EXHAUSTED) {
+                    if (outcome != FOUND) undo(before);
+                    return outcome;
+                }
+            } else {
+                stats_->failures++;
+                run_failures_++;
+            }
+            undo(before);
+            if (run_failures_ >= failure_limit_) return RESTART;
+        }
+        return EXHAUSTED;
+    }
+
+    int N_, words_;
+    std::vector<uint64_t> domain_;  // N filas x words_ palabras: columnas todavía posibles
+    std::vector<int> size_;         // Columnas posibles por fila
+    std::vector<int> count_;        // Filas (libres) donde cabe cada columna
+    std::vector<int> row_col_, col_row_;
+    std::vector<int> removed_;      // Trail de borrados (fila * N + columna)
+    std::vector<int> assigned_;     // Trail de filas colocadas
+    std::vector<int> pending_;      // Filas (r) y columnas (N + c) por revisar
+    bool contradiction_ = false;
+    bool consistent_ = true;
+    long long propagated_ = 0;
+    long long run_failures_ = 0, failure_limit_ = 0;
+    CompletionStats *stats_ = nullptr;
+    const CompletionOptions *options_ = nullptr;
+    SaRng rng_{1};
+};
+
+/**
+ * @brief Genera una instancia de completación con k reinas fijas.
+ * @param planted true: k filas de una solución completa (siempre completable); false: k reinas al azar sin atacarse.
+ */
+inline std::vector<QueenPlacement> nqueens_completion_instance(int N, int k, uint64_t seed, bool planted = false) {
+    SaRng rng(seed);
+    std::vector<int> rows(N);
+    for (int r = 0; r < N; ++r) rows[r] = r;
+    for (int r = N; r > 1; --r) std::swap(rows[r - 1], rows[rng.below(r)]);
+    k = std::min(k, N);
+
+    std::vector<QueenPlacement> fixed;
+    if (planted) {
+        std::vector<int> columns;
+        MinConflictsOptions options;
+        options.seed = rng.next();
+        if (!nqueens_min_conflicts(N, columns, options).found) return fixed;
+        for (int i = 0; i < k; ++i) fixed.push_back({rows[i], columns[rows[i]]});
+        return fixed;
+    }
+
+    std::vector<char> col(N, 0), sum(2 * N - 1, 0), diff(2 * N - 1, 0);
+    std::vector<int> free_columns;
+    for (int i = 0; i < N && (int)fixed.size() < k; ++i) {
+        int r = rows[i];
+        free_columns.clear();
+        for (int c = 0; c < N; ++c) {
+            if (!col[c] && !sum[r + c] && !diff[r - c + N - 1]) free_columns.push_back(c);
+        }
+        if (free_columns.empty()) continue; // Fila ya atacada entera: probar otra
+        int c = free_columns[rng.below((int)free_columns.size())];
+        col[c] = sum[r + c] = diff[r - c + N - 1] = 1;
+        fixed.push_back({r, c});
+    }
+    return fixed;
+}
+
+// Esfuerzo del resolvedor sobre una instancia: fallos (contradicciones), con un presupuesto de
+// nodos. Los nodos no sirven de medida: casi todos los pone la propagación, también en las fáciles.
+inline long long nqueens_completion_effort(int N, const std::vector<QueenPlacement> &fixed, uint64_t seed,
+                                           long long max_nodes, CompletionResult *result = nullptr) {
+    NQueensCompletion solver(N);
+    for (const QueenPlacement &q : fixed) solver.fix(q.row, q.col);
+    std::vector<int> columns;
+    CompletionOptions options;
+    options.seed = seed;
+    options.max_nodes = max_nodes;
+    CompletionStats stats = solver.solve(options, columns);
+    if (result != nullptr) *result = stats.result;
+    return stats.failures;
+}
+
+struct HardInstanceOptions {
+    int k_min = 0;                  // Menor k del barrido (0 = N/2)
+    int k_max = 0;                  // Mayor k del barrido (0 = 7N/8)
+    int k_steps = 8;                // Valores de k probados entre k_min y k_max
+    int samples = 6;                // Instancias al azar por cada k del barrido
+    int iterations = 200;           // Mutaciones del ascenso de colinas
+    int probes = 3;                 // Semillas del resolvedor por evaluación (las mismas para todas)
+    long long probe_nodes = 100000; // Presupuesto de cada evaluación
+    uint64_t seed = 1;
+};
+
+struct HardInstanceReport {
+    int k = 0;              // k elegido en el barrido
+    double effort = 0;      // Fallos medios de la instancia devuelta
+    double baseline = 0;    // Fallos medios de las instancias al azar con ese k (línea base)
+    int evaluated = 0;      // Instancias evaluadas (barrido + ascenso)
+};
+
+/**
+ * @brief Instancia difícil: barre k en [k_min, k_max] con instancias al azar, elige el k con más
+ * fallos medios y parte de su peor muestra para un ascenso de colinas que maximiza los fallos.
+ * @param report Salida opcional: k elegido, fallos de la instancia y línea base al azar con ese k.
+ */
+inline std::vector<QueenPlacement> nqueens_completion_hard_instance(int N, const HardInstanceOptions &options,
+                                                                    HardInstanceReport *report = nullptr) {
+    SaRng rng(options.seed);
+    HardInstanceReport local;
+    HardInstanceReport &out = report != nullptr ? *report : local;
+    out = HardInstanceReport();
+    // Semillas fijas: todas las instancias se miden con las mismas corridas del resolvedor.
+    std::vector<uint64_t> probe_seeds(std::max(1, options.probes));
+    for (uint64_t &seed : probe_seeds) seed = rng.next();
+    auto score = [&](const std::vector<QueenPlacement> &fixed) {
+        long long total = 0;
+        for (uint64_t seed : probe_seeds) total += nqueens_completion_effort(N, fixed, seed, options.probe_nodes);
+        out.evaluated++;
+        return (double)total / probe_seeds.size();
+    };
+
+    // Barrido de k: la zona difícil está cerca de la transición entre completable y sin solución.
+    int k_min = options.k_min > 0 ? options.k_min : N / 2;
+    int k_max = std::max(k_min, options.k_max > 0 ? options.k_max : 7 * N / 8);
+    int steps = std::max(1, std::min(options.k_steps, k_max - k_min + 1));
+    std::vector<QueenPlacement> best;
+    double best_score = -1, best_mean = -1;
+    for (int i = 0; i < steps; ++i) {
+        int k = steps == 1 ? k_min : k_min + (int)((long long)(k_max - k_min) * i / (steps - 1));
+        double total = 0, worst_score = -1;
+        std::vector<QueenPlacement> worst;
+        for (int j = 0; j < std::max(1, options.samples); ++j) {
+            std::vector<QueenPlacement> sample = nqueens_completion_instance(N, k, rng.next());
+            double value = score(sample);
+            total += value;
+            if (value > worst_score) {
+                worst_score = value;
+                worst.swap(sample);
+            }
+        }
+        double mean = total / std::max(1, options.samples);
+        if (mean > best_mean) {
+            best_mean = mean;
+            out.k = k;
+            out.baseline = mean;
+            best.swap(worst);
+            best_score = worst_score;
+        }
+    }
+
+    std::vector<char> row(N), col(N), sum(2 * N - 1), diff(2 * N - 1);
+    std::vector<QueenPlacement> free_cells;
+    for (int it = 0; it < options.iterations && !best.empty(); ++it) {
+        // Mover una reina: quitarla y poner otra en una casilla libre (fila vacía y sin ataques).
+        std::vector<QueenPlacement> candidate = best;
+        candidate.erase(candidate.begin() + rng.below((int)candidate.size()));
+        std::fill(row.begin(), row.end(), 0);
+        std::fill(col.begin(), col.end(), 0);
+        std::fill(sum.begin(), sum.end(), 0);
+        std::fill(diff.begin(), diff.end(), 0);
+        for (const QueenPlacement &q : candidate) {
+            row[q.row] = col[q.col] = sum[q.row + q.col] = diff[q.row - q.col + N - 1] = 1;
+        }
+        free_cells.clear();
+        for (int r = 0; r < N; ++r) {
+            if (row[r]) continue;
+            for (int c = 0; c < N; ++c) {
+                if (!col[c] && !sum[r + c] && !diff[r - c + N - 1]) free_cells.push_back({r, c});
+            }
+        }
+        if (free_cells.empty()) continue;
+        candidate.push_back(free_cells[rng.below((int)free_cells.size())]);
+        double candidate_score = score(candidate);
+        // Empates solo con fallos > 0: en la meseta de instancias triviales no hay pendiente que seguir.
+        if (candidate_score > best_score || (candidate_score == best_score && best_score > 0)) {
+            best.swap(candidate);
+            best_score = candidate_score;
+        }
+    }
+    out.effort = std::max(0.0, best_score);
+    return best;
+}
+
+// N del modo completación (SEARCH_COMPLETION_N=<N>), 0 si no está activo.
+inline int completion_mode_n() {
+    const char *value = std::getenv("SEARCH_COMPLETION_N");
+    return value != nullptr ? std::atoi(value) : 0;
+}
+
+#endif // NQUEENS_COMPLETION_H
@@ -0,0 +1,140 @@
+// --- Construcción explícita de N-Reinas en O(N) (patrones según N mod 6) ---
+//
+// Para todo N distinto de 2 y 3 hay una solución cerrada: las columnas
+// pares 2, 4, 6, ... seguidas de las impares 1, 3, 5, ... (en base 1), con
+// dos ajustes conocidos:
+//   N mod 6 == 2: en las impares se intercambian 1 y 3 y el 5 pasa al final.
+//   N mod 6 == 3: el 2 pasa al final de las pares y el 1 y el 3 al final de las impares.
+// La columna de cada fila se calcula en O(1) sin construir la lista, así que la
+// solución se puede emitir fila a fila (a un archivo, a un búfer, a un
+// verificador) sin guardar el tablero: memoria O(1) para cualquier N.
+//
+// NQueensVerifier comprueba un flujo de (fila, columna) con cuatro mapas de
+// bits (6N bits): sirve para validar la construcción y como carga de trabajo para
+// N = 10^8.
+
+#ifndef NQUEENS_CONSTRUCTIVE_H
+#define NQUEENS_CONSTRUCTIVE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// ¿Hay solución para N? (todas salvo 2 y 3)
+inline bool nqueens_constructive_exists(long long N) {
+    return N >= 1 && N != 2 && N != 3;
+}
+
+/**
+ * @brief Columna (base 0) de la reina de la fila `row` (base 0) en la solución explícita.
+ */
+inline long long nqueens_constructive_column(long long N, long long row) {
+    const long long evens = N / 2, odds = N - evens;
+    const int rest = (int)(N % 6);
+    long long col; // Base 1
+    if (row < evens) {
+        if (rest == 3) col = row + 1 < evens ? 2 * (row + 2) : 2; // 4, 6, ..., 2
+        else col = 2 * (row + 1);                                 // 2, 4, 6, ...
+    } else {
+        long long k = row - evens;
+        if (rest == 2) col = k == 0 ? 3 : (k == 1 ? 1 : (k + 1 < odds ? 2 * k + 3 : 5)); // 3, 1, 7, 9, ..., 5
+        else if (rest == 3) col = k + 2 < odds ? 2 * k + 5 : (k + 2 == odds ? 1 : 3);    // 5, 7, ..., 1, 3
+        else col = 2 * k + 1;                                                              // 1, 3, 5, ...
+    }
+    return col - 1;
+}
+
+/**
+ * @brief Emite la solución fila a fila: sink(fila, columna) en orden, sin guardar el tablero.
+ * @return false si N no tiene solución (2 o 3) o no es positivo.
+ */
+template <class Sink>
+bool nqueens_constructive(long long N, Sink &&sink) {
+    if (!nqueens_constructive_exists(N)) return false;
+    for (long long row = 0; row < N; ++row) sink(row, nqueens_constructive_column(N, row));
+    return true;
+}
+
+/**
+ * @brief Escribe la columna (base 0) de cada fila, una por línea, con un búfer propio.
+ */
+class NQueensColumnWriter {
+public:
+    explicit NQueensColumnWriter(FILE *out, size_t buffer_bytes = 1 << 20) : out_(out), buffer_(buffer_bytes) {}
+    ~NQueensColumnWriter() { flush(); }
+    NQueensColumnWriter(const NQueensColumnWriter &) = delete;
+    NQueensColumnWriter &operator=(const NQueensColumnWriter &) = delete;
+
+    void operator()(long long, long long col) {
+        if (used_ + 24 > buffer_.size()) flush();
+        char digits[24];
+        int n = 0;
+        do {
+            digits[n++] = (char)('0' + col % 10);
+            col /= 10;
+        } while (col > 0);
+        while (n > 0) buffer_[used_++] = digits[--n];
+        buffer_[used_++] = '\n';
+    }
+
+    void flush() {
+        if (used_ == 0) return;
+        bytes_ += std::fwrite(buffer_.data(), 1, used_, out_);
+        used_ = 0;
+    }
+    unsigned long long bytes() const { return bytes_; }
+
+private:
+    FILE *out_;
+    std::vector<char> buffer_;
+    size_t used_ = 0;
+    unsigned long long bytes_ = 0;
+};
+
+/**
+ * @brief Verificador en flujo: cada fila, columna y diagonal a lo sumo una vez (6N bits).
+ */
+class NQueensVerifier {
+public:
+    explicit NQueensVerifier(long long N)
+        : N_(N), rows_(words(N), 0), cols_(words(N), 0), sums_(words(2 * N), 0), diffs_(words(2 * N), 0) {}
+
+    void operator()(long long row, long long col) {
+        placed_++;
+        if (row < 0 || row >= N_ || col < 0 || col >= N_) {
+            valid_ = false;
+            return;
+        }
+        valid_ &= claim(rows_, row) & claim(cols_, col) & claim(sums_, row + col) & claim(diffs_, row - col + N_ - 1);
+    }
+
+    // ¿Se colocaron exactamente N reinas sin ataques?
+    bool valid() const { return valid_ && placed_ == N_; }
+    long long placed() const { return placed_; }
+    size_t bytes() const { return (rows_.size() + cols_.size() + sums_.size() + diffs_.size()) * sizeof(uint64_t); }
+
+private:
+    static size_t words(long long bits) { return (size_t)((bits + 63) / 64); }
+    // Marca el bit; false si ya estaba marcado (dos reinas en la misma línea).
+    static bool claim(std::vector<uint64_t> &bits, long long i) {
+        uint64_t mask = 1ULL << (i & 63);
+        uint64_t &word = bits[(size_t)(i >> 6)];
+        bool fresh = (word & mask) == 0;
+        word |= mask;
+        return fresh;
+    }
+
+    long long N_;
+    std::vector<uint64_t> rows_, cols_, sums_, diffs_;
+    long long placed_ = 0;
+    bool valid_ = true;
+};
+
+// N del modo constructivo (SEARCH_CONSTRUCT_N=<N>), 0 si no está activo.
+inline long long construct_mode_n() {
+    const char *value = std::getenv("SEARCH_CONSTRUCT_N");
+    return value != nullptr ? std::atoll(value) : 0;
+}
+
+#endif // NQUEENS_CONSTRUCTIVE_H
@@ -0,0 +1,145 @@
+// --- N-Reinas con N fijo en compilación (template<int N>) ---
+//
+// Cada archivo N-queens fija N en main(), pero nqueens_count_from recibe la
+// máscara completa como parámetro y no sabe en qué fila está. Aquí N y la
+// fila son parámetros de plantilla: cada fila es una instancia distinta, la
+// máscara es una constante y la última fila se resuelve sin recursión (queda
+// una sola columna libre como mucho). El compilador ve la cadena entera de
+// llamadas y puede desenrollar e integrar los niveles.
+//
+// La primera solución se escribe en un std::array<int, N>: tamaño conocido,
+// sin reservas ni comprobaciones de límites.
+//
+// nqueens_count_dispatch / nqueens_first_dispatch eligen la instancia en
+// tiempo de ejecución con una tabla de punteros (N = 4..16) y usan la versión
+// genérica de nqueens_bitboard.h para cualquier otro N.
+
+#ifndef NQUEENS_FIXED_H
+#define NQUEENS_FIXED_H
+
+#include "nqueens_bitboard.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+constexpr int NQUEENS_FIXED_MIN = 4;
+constexpr int NQUEENS_FIXED_MAX = 16;
+
+template <int N>
+struct NQueensFixed {
+    static_assert(N >= 1 && N <= 64, "NQueensFixed admite 1 <= N <= 64");
+    static constexpr uint64_t full = N >= 64 ? ~0ULL : (1ULL << N) - 1;
+
+    // Soluciones del subárbol que empieza en la fila Row.
+    template <int Row>
+    static long long count(uint64_t cols, uint64_t ld, uint64_t rd, long long &nodes) {
+        uint64_t free = full & ~(cols | ld | rd);
+        if constexpr (Row == N - 1) {
+            nodes += free != 0; // Última fila: a lo sumo una columna libre
+            return free != 0;
+        } else {
+            long long total = 0;
+            while (free != 0) {
+                uint64_t bit = free & (0 - free);
+                free ^= bit;
+                nodes++;
+                total += count<Row + 1>(cols | bit, ((ld | bit) << 1) & full, (rd | bit) >> 1, nodes);
+            }
+            return total;
+        }
+    }
+
+    // Primera solución desde la fila Row; columns[fila] = columna.
+    template <int Row>
+    static bool first(uint64_t cols, uint64_t ld, uint64_t rd, std::array<int, N> &columns, long long &nodes) {
+        uint64_t free = full & ~(cols | ld | rd);
+        if constexpr (Row == N - 1) {
+            if (free == 0) return false;
+            nodes++;
+            columns[Row] = __builtin_ctzll(free);
+            return true;
+        } else {
+            while (free != 0) {
+                uint64_t bit = free & (0 - free);
+                free ^= bit;
+                nodes++;
+                columns[Row] = __builtin_ctzll(bit);
+                if (first<Row + 1>(cols | bit, ((ld | bit) << 1) & full, (rd | bit) >> 1, columns, nodes)) return true;
+            }
+            return false;
+        }
+    }
+};
+
+/**
+ * @brief Cuenta todas las soluciones con N fijo en compilación.
+ */
+template <int N>
+BitboardStats nqueens_fixed_count() {
+    BitboardStats stats;
+    stats.solutions = NQueensFixed<N>::template count<0>(0, 0, 0, stats.nodes);
+    return stats;
+}
+
+/**
+ * @brief Primera solución con N fijo en compilación (mismo orden que nqueens_bitboard_first).
+ */
+template <int N>
+BitboardStats nqueens_fixed_first(std::array<int, N> &columns) {
+    BitboardStats stats;
+    if (NQueensFixed<N>::template first<0>(0, 0, 0, columns, stats.nodes)) stats.solutions = 1;
+    return stats;
+}
+
+template <int N>
+BitboardStats nqueens_fixed_first_vector(std::vector<int> &columns) {
+    std::array<int, N> board;
+    BitboardStats stats = nqueens_fixed_first<N>(board);
+    if (stats.solutions > 0) columns.assign(board.begin(), board.end());
+    else columns.clear();
+    return stats;
+}
+
+// Tablas de instancias para N = NQUEENS_FIXED_MIN..NQUEENS_FIXED_MAX.
+using NQueensCountFn = BitboardStats (*)();
+using NQueensFirstFn = BitboardStats (*)(std::vector<int> &);
+
+template <std::size_t... I>
+constexpr std::array<NQueensCountFn, sizeof...(I)> nqueens_fixed_count_table(std::index_sequence<I...>) {
+    return {{&nqueens_fixed_count<NQUEENS_FIXED_MIN + (int)I>...}};
+}
+
+template <std::size_t... I>
+constexpr std::array<NQueensFirstFn, sizeof...(I)> nqueens_fixed_first_table(std::index_sequence<I...>) {
+    return {{&nqueens_fixed_first_vector<NQUEENS_FIXED_MIN + (int)I>...}};
+}
+
+// ¿Hay instancia compilada para este N?
+inline bool nqueens_fixed_available(int N) {
+    return N >= NQUEENS_FIXED_MIN && N <= NQUEENS_FIXED_MAX;
+}
+
+/**
+ * @brief Cuenta las soluciones con la instancia de N si existe; si no, con nqueens_bitboard_count.
+ */
+inline BitboardStats nqueens_count_dispatch(int N) {
+    static constexpr auto table =
+        nqueens_fixed_count_table(std::make_index_sequence<NQUEENS_FIXED_MAX - NQUEENS_FIXED_MIN + 1>());
+    if (!nqueens_fixed_available(N)) return nqueens_bitboard_count(N);
+    return table[N - NQUEENS_FIXED_MIN]();
+}
+
+/**
+ * @brief Primera solución con la instancia de N si existe; si no, con nqueens_bitboard_first.
+ */
+inline BitboardStats nqueens_first_dispatch(int N, std::vector<int> &columns) {
+    static constexpr auto table =
+        nqueens_fixed_first_table(std::make_index_sequence<NQUEENS_FIXED_MAX - NQUEENS_FIXED_MIN + 1>());
+    if (!nqueens_fixed_available(N)) return nqueens_bitboard_first(N, columns);
+    return table[N - NQUEENS_FIXED_MIN](columns);
+}
+
+#endif // NQUEENS_FIXED_H
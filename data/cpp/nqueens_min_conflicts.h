@@ -0,0 +1,198 @@
+// --- Min-conflicts para N-Reinas con contadores de ocupación ---
+//
+// Una reina por fila; por cada columna y cada diagonal se cuenta cuántas
+// reinas hay. Con eso, los conflictos de poner la reina de la fila r en la
+// columna c son col[c] + suma[r + c] + resta[r - c + N - 1]: O(1) por
+// casilla, sin recorrer el tablero (count_conflicts es O(N²)).
+//
+// Inicialización voraz (estilo Sosic-Gu): las columnas salen de una
+// permutación (sin choques de columna) y para cada fila se prueban unas pocas
+// columnas libres al azar hasta dar con una sin choque diagonal. Quedan muy
+// pocos conflictos, casi todos en las últimas filas.
+//
+// Cada paso toma al azar una fila atacada y mueve su reina a la columna de
+// menos conflictos (empates al azar; puede quedarse donde está). Mover una
+// reina es O(1); elegir la columna recorre la fila, O(N), con instrucciones
+// vectoriales cuando la CPU las tiene.
+
+#ifndef NQUEENS_MIN_CONFLICTS_H
+#define NQUEENS_MIN_CONFLICTS_H
+
+#include "anytime_profile.h"
+#include "simulated_annealing.h"
+#include "nqueens_simd.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+
+struct MinConflictsOptions {
+    long long max_steps = 0;                 // Movimientos como máximo (0 = 100 * N + 10000)
+    int init_tries = 32;                     // Columnas al azar probadas por fila al inicializar
+    uint64_t seed = 1;
+    const std::atomic<bool> *stop = nullptr; // Cancelación externa, cada 1024 pasos
+};
+
+struct MinConflictsStats {
+    bool found = false;
+    long long initial_conflicts = 0;  // Pares atacados tras la inicialización voraz
+    long long final_conflicts = 0;
+    long long steps = 0;              // Reinas movidas
+};
+
+// Contadores de ocupación del tablero (columna, diagonal r + c y diagonal r - c + N - 1).
+struct QueenOccupancy {
+    int N;
+    std::vector<int> col, sum, diff;
+
+    explicit QueenOccupancy(int N) : N(N), col(N, 0), sum(2 * N - 1, 0), diff(2 * N - 1, 0) {}
+
+    // Reinas que atacarían (r, c), contando la propia si está ahí.
+    int at(int r, int c) const { return col[c] + sum[r + c] + diff[r - c + N - 1]; }
+};
+
+/**
+ * @brief Columna de menos conflictos para la reina de la fila r (ya retirada del tablero).
+ *
+ * Puntúa la fila entera con row_argmin (AVX2 / SSE4.1 / escalar, ver
+ * nqueens_simd.h); los empates se eligen al azar.
+ */
+inline int nqueens_min_conflict_column(const QueenOccupancy &board, int r, SaRng &rng) {
+    RowScores row{board.col.data(), board.sum.data() + r, board.diff.data() + r + board.N - 1, board.N};
+    return row_argmin(row, rng);
+}
+
+/**
+ * @brief Tablero de min-conflicts: contadores, asignación y conjunto exacto de filas atacadas.
+ *
+ * Además del número de reinas por línea se guarda la suma de sus filas: cuando
+ * una línea pasa a tener 2 reinas (o vuelve a 1) la suma identifica a la otra,
+ * que entra o sale del conjunto de atacadas sin recorrer el tablero.
+ */
+class MinConflictsBoard {
+public:
+    explicit MinConflictsBoard(int N) : occupancy(N), columns(N, -1), slot(N, -1) {
+        rows[0].assign(N, 0);
+        rows[1].assign(2 * N - 1, 0);
+        rows[2].assign(2 * N - 1, 0);
+    }
+
+    const QueenOccupancy &counts() const { return occupancy; }
+    int column(int r) const { return columns[r]; }
+    long long conflicts() const { return pairs; }
+    int attacked_count() const { return (int)attacked.size(); }
+    int attacked_row(int i) const { return attacked[i]; }
+
+    void place(int r, int c) {
+        columns[r] = c;
+        for (int k = 0; k < 3; ++k) {
+            int &count = line_count(k, r);
+            long long &sum = rows[k][line(k, r)];
+            pairs += count++;
+            if (count == 2) refresh((int)sum, true); // La que estaba sola pasa a estar atacada
+            sum += r;
+        }
+        refresh(r, occupancy.at(r, c) > 3);
+    }
+
+    void lift(int r) {
+        for (int k = 0; k < 3; ++k) {
+            int &count = line_count(k, r);
+            long long &sum = rows[k][line(k, r)];
+            pairs -= --count;
+            sum -= r;
+            if (count == 1) refresh((int)sum, occupancy.at((int)sum, columns[(int)sum]) > 3);
+        }
+        refresh(r, false);
+        columns[r] = -1;
+    }
+
+private:
+    int line(int k, int r) const {
+        int c = columns[r];
+        return k == 0 ? c : (k == 1 ? r + c : r - c + occupancy.N - 1);
+    }
+    int &line_count(int k, int r) {
+        std::vector<int> &counts = k == 0 ? occupancy.col : (k == 1 ? occupancy.sum : occupancy.diff);
+        return counts[line(k, r)];
+    }
+
+    // Mantiene r dentro o fuera del conjunto de filas atacadas.
+    void refresh(int r, bool hit) {
+        if (hit && slot[r] < 0) {
+            slot[r] = (int)attacked.size();
+            attacked.push_back(r);
+        } else if (!hit && slot[r] >= 0) {
+            int last = attacked.back();
+            attacked[slot[r]] = last;
+            slot[last] = slot[r];
+            attacked.pop_back();
+            slot[r] = -1;
+        }
+    }
+
+    QueenOccupancy occupancy;
+    std::vector<int> columns;          // Columna de cada fila (-1 = sin colocar)
+    std::vector<long long> rows[3];    // Suma de las filas de las reinas de cada línea
+    std::vector<int> attacked;         // Filas atacadas
+    std::vector<int> slot;             // Posición de cada fila en "attacked" (-1 = fuera)
+    long long pairs = 0;               // Pares de reinas que se atacan
+};
+
+/**
+ * @brief Resuelve N-Reinas con min-conflicts.
+ * @param columns Salida: columns[fila] = columna de la última asignación (solución si found).
+ * @param profile Curva opcional conflictos vs. tiempo.
+ */
+inline MinConflictsStats nqueens_min_conflicts(int N, std::vector<int> &columns, const MinConflictsOptions &options,
+                                               AnytimeProfile *profile = nullptr) {
+    MinConflictsStats stats;
+    SaRng rng(options.seed);
+    MinConflictsBoard board(N);
+
+    // Inicialización voraz: free_columns[r..N-1] son las columnas todavía libres.
+    std::vector<int> free_columns(N);
+    for (int i = 0; i < N; ++i) free_columns[i] = i;
+    for (int r = 0; r < N; ++r) {
+        int pick = r + rng.below(N - r);
+        for (int t = 0; t < options.init_tries; ++t) {
+            int j = r + rng.below(N - r);
+            int c = free_columns[j];
+            if (board.counts().sum[r + c] == 0 && board.counts().diff[r - c + N - 1] == 0) {
+                pick = j;
+                break;
+            }
+        }
+        std::swap(free_columns[r], free_columns[pick]);
+        board.place(r, free_columns[r]);
+    }
+    stats.initial_conflicts = board.conflicts();
+    if (profile != nullptr) profile->record(board.conflicts());
+
+    // N = 2 y N = 3 no tienen solución: el límite de pasos corta la búsqueda.
+    const long long max_steps = options.max_steps > 0 ? options.max_steps : 100LL * N + 10000;
+    while (board.conflicts() > 0 && stats.steps < max_steps) {
+        if ((stats.steps & 1023) == 0 && options.stop != nullptr && options.stop->load(std::memory_order_relaxed)) break;
+        stats.steps++;
+        int r = board.attacked_row(rng.below(board.attacked_count()));
+        board.lift(r);
+        board.place(r, nqueens_min_conflict_column(board.counts(), r, rng));
+        if (profile != nullptr) profile->record(board.conflicts());
+    }
+
+    columns.resize(N);
+    for (int r = 0; r < N; ++r) columns[r] = board.column(r);
+    stats.final_conflicts = board.conflicts();
+    stats.found = board.conflicts() == 0;
+    return stats;
+}
+
+// N del modo min-conflicts (SEARCH_MINCONFLICTS_N=<N>), 0 si no está activo.
+inline int minconflicts_mode_n() {
+    const char *value = std::getenv("SEARCH_MINCONFLICTS_N");
+    return value != nullptr ? std::atoi(value) : 0;
+}
+
+#endif // NQUEENS_MIN_CONFLICTS_H
@@ -0,0 +1,210 @@
+// --- Conteo paralelo de N-Reinas con robo de trabajo ---
+//
+// Fijando las primeras filas, cada prefijo válido (tres máscaras) es un
+// subárbol independiente. Se generan prefijos hasta tener varias decenas de
+// tareas por hilo (con el reflejo de nqueens_count_mirror en la primera fila),
+// se reparten en bloques contiguos entre las colas de los hilos y cada hilo
+// cuenta los suyos con nqueens_count_from. Un hilo sin trabajo roba del otro
+// extremo de la cola de otro hilo, así que los subárboles desiguales no dejan
+// núcleos ociosos.
+//
+// Los contadores de cada hilo viven en su propia línea de caché y solo se suman
+// al final: no hay escrituras compartidas en el bucle caliente. El resultado es
+// determinista (suma de enteros) sea cual sea el reparto.
+//
+// Checkpoints: con SEARCH_CHECKPOINT_FILE definido (o un CheckpointConfig
+// explícito) se vuelcan, como mucho cada interval_seconds, qué prefijos están
+// terminados y cuántas soluciones y nodos sumaron. La unidad es la tarea
+// entera: un subárbol a medias se vuelve a contar al reanudar. La huella
+// incluye N y el número de filas fijadas, así que al reanudar hay que usar el
+// mismo tasks_per_thread y un número de hilos que dé los mismos prefijos (con
+// un solo hilo, el conteo sigue siendo reanudable). El archivo se borra al
+// terminar el conteo.
+
+#ifndef NQUEENS_PARALLEL_H
+#define NQUEENS_PARALLEL_H
+
+#include "nqueens_bitboard.h"
+#include "checkpoint.h"
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+
+struct NQueensPrefix {
+    uint64_t cols, ld, rd;
+    int weight;  // 2 si su espejo no se recorre por separado, 1 para la columna central
+};
+
+struct ParallelCountStats {
+    long long solutions = 0;
+    long long nodes = 0;
+    int threads = 0;
+    int prefix_rows = 0;   // Filas fijadas en cada tarea
+    size_t tasks = 0;      // Prefijos generados
+    long long steals = 0;  // Tareas ejecutadas por un hilo distinto del dueño
+    size_t resumed_tasks = 0; // Tareas ya terminadas en el checkpoint cargado
+    int checkpoints = 0;      // Checkpoints escritos
+};
+
+// Prefijos válidos con `rows` filas colocadas (la primera solo en la mitad izquierda).
+inline std::vector<NQueensPrefix> nqueens_prefixes(int N, int rows) {
+    const uint64_t full = nqueens_full_mask(N);
+    std::vector<NQueensPrefix> level, next;
+    for (int col = 0; col < (N + 1) / 2; ++col) {
+        uint64_t bit = 1ULL << col;
+        level.push_back({bit, (bit << 1) & full, bit >> 1, (N % 2 == 1 && col == N / 2) ? 1 : 2});
+    }
+    for (int row = 1; row < rows; ++row) {
+        next.clear();
+        for (const NQueensPrefix &p : level) {
+            uint64_t free = full & ~(p.cols | p.ld | p.rd);
+            while (free != 0) {
+                uint64_t bit = free & (0 - free);
+                free ^= bit;
+                next.push_back({p.cols | bit, ((p.ld | bit) << 1) & full, (p.rd | bit) >> 1, p.weight});
+            }
+        }
+        level.swap(next);
+    }
+    return level;
+}
+
+// Huella de los checkpoints del conteo: N y el reparto en prefijos.
+inline uint64_t nqueens_count_fingerprint(int N, int prefix_rows, size_t tasks) {
+    return checkpoint_hash({(uint64_t)N, (uint64_t)prefix_rows, (uint64_t)tasks}, checkpoint_hash("nqueens_count_parallel"));
+}
+
+/**
+ * @brief Cuenta todas las soluciones de N-Reinas en paralelo (1 <= N <= 64).
+ * @param num_threads Número de hilos (0 = todos los núcleos disponibles).
+ * @param tasks_per_thread Prefijos por hilo que se intentan generar (granularidad del reparto).
+ * @param checkpoint Dónde y cada cuánto volcar las tareas terminadas (por defecto, desde el entorno).
+ */
+inline ParallelCountStats nqueens_count_parallel(int N, int num_threads = 0, int tasks_per_thread = 64,
+                                                 const CheckpointConfig &checkpoint = CheckpointConfig::from_env()) {
+    using Clock = std::chrono::steady_clock;
+    ParallelCountStats stats;
+    if (N < 1 || N > 64) return stats;
+    if (num_threads <= 0) num_threads = (int)std::max(1u, std::thread::hardware_concurrency());
+    const int T = num_threads;
+    const uint64_t full = nqueens_full_mask(N);
+    stats.threads = T;
+
+    // Fijar filas hasta tener suficientes tareas (sin pasar de N - 1: la última fila es trivial).
+    std::vector<NQueensPrefix> prefixes = nqueens_prefixes(N, 1);
+    stats.prefix_rows = 1;
+    while (prefixes.size() < (size_t)T * tasks_per_thread && stats.prefix_rows + 1 < N) {
+        stats.prefix_rows++;
+        prefixes = nqueens_prefixes(N, stats.prefix_rows);
+    }
+    stats.tasks = prefixes.size();
+
+    // Progreso compartido: solo se toca al cerrar una tarea, fuera del bucle caliente.
+    struct Progress {
+        std::mutex mutex;
+        std::vector<uint8_t> done;  // done[i] = 1 si el prefijo i ya está contado
+        long long solutions = 0;    // Suma de las tareas terminadas (incluidas las del checkpoint)
+        long long nodes = 0;
+        Clock::time_point last = Clock::now();
+    } progress;
+    progress.done.assign(prefixes.size(), 0);
+    const uint64_t fingerprint = nqueens_count_fingerprint(N, stats.prefix_rows, prefixes.size());
+    auto save_checkpoint = [&]() {
+        CheckpointWriter writer(checkpoint.path, sizeof(NQueensPrefix), fingerprint);
+        long long counters[2] = {progress.solutions, progress.nodes};
+        writer.write(counters);
+        writer.write_vector(progress.done);
+        if (writer.commit()) stats.checkpoints++;
+    };
+    if (checkpoint.path != nullptr) {
+        CheckpointReader reader(checkpoint.path, sizeof(NQueensPrefix), fingerprint);
+        long long counters[2];
+        std::vector<uint8_t> done;
+        if (reader.read(counters) && reader.read_vector(done) && done.size() == prefixes.size()) {
+            progress.done.swap(done);
+            progress.solutions = counters[0];
+            progress.nodes = counters[1];
+            stats.resumed_tasks = (size_t)std::count(progress.done.begin(), progress.done.end(), 1);
+        }
+    }
+
+    struct alignas(64) Worker {
+        std::mutex mutex;
+        std::deque<size_t> queue;  // Índices de prefijos: el dueño saca por detrás, los ladrones por delante
+        long long solutions = 0;
+        long long nodes = 0;
+        long long steals = 0;
+    };
+    std::vector<Worker> workers(T);
+    for (size_t i = 0; i < prefixes.size(); ++i) {
+        if (!progress.done[i]) workers[i * T / prefixes.size()].queue.push_back(i);
+    }
+
+    auto run = [&](int id) {
+        Worker &self = workers[id];
+        while (true) {
+            size_t task = 0;
+            bool have = false;
+            {
+                std::lock_guard<std::mutex> lock(self.mutex);
+                if (!self.queue.empty()) {
+                    task = self.queue.back();
+                    self.queue.pop_back();
+                    have = true;
+                }
+            }
+            for (int k = 1; k < T && !have; ++k) {
+                Worker &victim = workers[(id + k) % T];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.queue.empty()) {
+                    task = victim.queue.front();
+                    victim.queue.pop_front();
+                    have = true;
+                    self.steals++;
+                }
+            }
+            if (!have) return; // No se generan tareas nuevas: todas las colas vacías = fin
+            const NQueensPrefix &p = prefixes[task];
+            long long nodes = 0;
+            long long solutions = p.weight * nqueens_count_from(full, p.cols, p.ld, p.rd, nodes);
+            self.solutions += solutions;
+            self.nodes += nodes;
+            if (checkpoint.path != nullptr) {
+                std::lock_guard<std::mutex> lock(progress.mutex);
+                progress.done[task] = 1;
+                progress.solutions += solutions;
+                progress.nodes += nodes;
+                double elapsed = std::chrono::duration<double>(Clock::now() - progress.last).count();
+                if (elapsed >= checkpoint.interval_seconds) {
+                    save_checkpoint();
+                    progress.last = Clock::now();
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < T; ++i) threads.emplace_back(run, i);
+    run(0);
+    for (auto &t : threads) t.join();
+
+    for (const Worker &w : workers) {
+        stats.solutions += w.solutions;
+        stats.nodes += w.nodes;
+        stats.steals += w.steals;
+    }
+    if (checkpoint.path != nullptr) {
+        // Las tareas del checkpoint no se recorrieron en esta ejecución: se suman sus totales.
+        stats.solutions = progress.solutions;
+        stats.nodes = progress.nodes;
+        std::remove(checkpoint.path); // Conteo terminado: ya no hay nada que reanudar
+    }
+    return stats;
+}
+
+#endif // NQUEENS_PARALLEL_H
@@ -0,0 +1,159 @@
+// --- Evaluación vectorial de una fila de N-Reinas (AVX2 / SSE4.1 / escalar) ---
+//
+// Para mover la reina de la fila r hay que puntuar las N columnas:
+// col[c] + sum[r + c] + diff[r - c + N - 1]. Las dos primeras se leen
+// hacia adelante y la tercera hacia atrás, así que con vectores de enteros de
+// 32 bits se cargan 8 (AVX2) o 4 (SSE4.1) columnas a la vez, se invierte el
+// bloque de diff y se suman. La columna elegida sale en dos pasadas: mínimo
+// vectorial y luego elección uniforme entre los empates (muestreo por
+// reservorio por bloque: máscara de igualdad + un bit al azar).
+//
+// El nivel se elige en tiempo de ejecución con __builtin_cpu_supports y las
+// funciones vectoriales se compilan con atributos target, así que el binario
+// sigue funcionando sin -march. SEARCH_SIMD=scalar|sse4|avx2 limita el nivel
+// (útil para comparar).
+
+#ifndef NQUEENS_SIMD_H
+#define NQUEENS_SIMD_H
+
+#include "simulated_annealing.h"
+
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define NQUEENS_SIMD_X86 1
+#endif
+
+enum SimdLevel { SIMD_SCALAR, SIMD_SSE4, SIMD_AVX2 };
+
+inline const char *simd_level_name(SimdLevel level) {
+    return level == SIMD_AVX2 ? "AVX2" : (level == SIMD_SSE4 ? "SSE4.1" : "escalar");
+}
+
+// Mejor nivel disponible en esta CPU, limitado por SEARCH_SIMD si está definido.
+inline SimdLevel simd_level() {
+    static const SimdLevel level = [] {
+        SimdLevel best = SIMD_SCALAR;
+#ifdef NQUEENS_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("sse4.1")) best = SIMD_SSE4;
+        if (__builtin_cpu_supports("avx2")) best = SIMD_AVX2;
+#endif
+        const char *cap = std::getenv("SEARCH_SIMD");
+        if (cap != nullptr) {
+            if (std::strcmp(cap, "scalar") == 0 || std::strcmp(cap, "0") == 0) best = SIMD_SCALAR;
+            else if (std::strcmp(cap, "sse4") == 0 && best > SIMD_SSE4) best = SIMD_SSE4;
+        }
+        return best;
+    }();
+    return level;
+}
+
+// Puntuaciones de la fila: score(c) = col[c] + sum[c] + diff_end[-c] (punteros ya desplazados a la fila).
+struct RowScores {
+    const int *col;
+    const int *sum;
+    const int *diff_end;
+    int n;
+
+    int at(int c) const { return col[c] + sum[c] + diff_end[-c]; }
+};
+
+// Elige uniformemente una de las columnas [c, c + width) cuya máscara de igualdad está encendida.
+inline void simd_pick_tie(unsigned mask, int c, int &ties, int &best, SaRng &rng) {
+    int count = __builtin_popcount(mask);
+    ties += count;
+    if (rng.below(ties) >= count) return; // Este bloque no reemplaza a la elección actual
+    for (int k = rng.below(count); k > 0; --k) mask &= mask - 1;
+    best = c + __builtin_ctz(mask);
+}
+
+inline int row_argmin_scalar(const RowScores &row, SaRng &rng) {
+    int best_value = INT_MAX;
+    for (int c = 0; c < row.n; ++c) best_value = std::min(best_value, row.at(c));
+    int best = -1, ties = 0;
+    for (int c = 0; c < row.n; ++c) {
+        if (row.at(c) == best_value && rng.below(++ties) == 0) best = c;
+    }
+    return best;
+}
+
+#ifdef NQUEENS_SIMD_X86
+__attribute__((target("sse4.1"))) inline __m128i row_block_sse4(const RowScores &row, int c) {
+    __m128i a = _mm_loadu_si128((const __m128i *)(row.col + c));
+    __m128i b = _mm_loadu_si128((const __m128i *)(row.sum + c));
+    __m128i d = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(row.diff_end - c - 3)), 0x1B); // Invertir
+    return _mm_add_epi32(_mm_add_epi32(a, b), d);
+}
+
+__attribute__((target("sse4.1"))) inline int row_argmin_sse4(const RowScores &row, SaRng &rng) {
+    const int blocks = row.n / 4 * 4;
+    __m128i low = _mm_set1_epi32(INT_MAX);
+    for (int c = 0; c < blocks; c += 4) low = _mm_min_epi32(low, row_block_sse4(row, c));
+    low = _mm_min_epi32(low, _mm_shuffle_epi32(low, 0x4E));
+    low = _mm_min_epi32(low, _mm_shuffle_epi32(low, 0xB1));
+    int best_value = _mm_cvtsi128_si32(low);
+    for (int c = blocks; c < row.n; ++c) best_value = std::min(best_value, row.at(c));
+
+    const __m128i target = _mm_set1_epi32(best_value);
+    int best = -1, ties = 0;
+    for (int c = 0; c < blocks; c += 4) {
+        unsigned mask = (unsigned)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(row_block_sse4(row, c), target)));
+        if (mask != 0) simd_pick_tie(mask, c, ties, best, rng);
+    }
+    for (int c = blocks; c < row.n; ++c) {
+        if (row.at(c) == best_value && rng.below(++ties) == 0) best = c;
+    }
+    return best;
+}
+
+__attribute__((target("avx2"))) inline __m256i row_block_avx2(const RowScores &row, int c) {
+    const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    __m256i a = _mm256_loadu_si256((const __m256i *)(row.col + c));
+    __m256i b = _mm256_loadu_si256((const __m256i *)(row.sum + c));
+    __m256i d = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i *)(row.diff_end - c - 7)), reverse);
+    return _mm256_add_epi32(_mm256_add_epi32(a, b), d);
+}
+
+__attribute__((target("avx2"))) inline int row_argmin_avx2(const RowScores &row, SaRng &rng) {
+    const int blocks = row.n / 8 * 8;
+    __m256i low8 = _mm256_set1_epi32(INT_MAX);
+    for (int c = 0; c < blocks; c += 8) low8 = _mm256_min_epi32(low8, row_block_avx2(row, c));
+    __m128i low = _mm_min_epi32(_mm256_castsi256_si128(low8), _mm256_extracti128_si256(low8, 1));
+    low = _mm_min_epi32(low, _mm_shuffle_epi32(low, 0x4E));
+    low = _mm_min_epi32(low, _mm_shuffle_epi32(low, 0xB1));
+    int best_value = _mm_cvtsi128_si32(low);
+    for (int c = blocks; c < row.n; ++c) best_value = std::min(best_value, row.at(c));
+
+    const __m256i target = _mm256_set1_epi32(best_value);
+    int best = -1, ties = 0;
+    for (int c = 0; c < blocks; c += 8) {
+        unsigned mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(row_block_avx2(row, c), target)));
+        if (mask != 0) simd_pick_tie(mask, c, ties, best, rng);
+    }
+    for (int c = blocks; c < row.n; ++c) {
+        if (row.at(c) == best_value && rng.below(++ties) == 0) best = c;
+    }
+    return best;
+}
+#endif
+
+/**
+ * @brief Columna de puntuación mínima de la fila, con empates elegidos uniformemente.
+ */
+inline int row_argmin(const RowScores &row, SaRng &rng) {
+#ifdef NQUEENS_SIMD_X86
+    switch (simd_level()) {
+        case SIMD_AVX2: return row_argmin_avx2(row, rng);
+        case SIMD_SSE4: return row_argmin_sse4(row, rng);
+        default: break;
+    }
+#endif
+    return row_argmin_scalar(row, rng);
+}
+
+#endif // NQUEENS_SIMD_H
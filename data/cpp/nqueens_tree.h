@@ -0,0 +1,170 @@
+// --- BFS y A* en modo árbol para N-Reinas (sin conjunto de visitados) ---
+//
+// Colocando una reina por fila, cada tablero parcial se alcanza por un único
+// camino: el espacio es un árbol y nunca aparece un duplicado. Un set<State>
+// de visitados solo gasta memoria y O(log n) por consulta sin podar nada.
+//
+// Aquí la frontera se guarda nivel a nivel como un arreglo de bytes: un nodo
+// del nivel d son sus d columnas (1 byte cada una, N <= 64), contiguas. Las
+// máscaras de columnas y diagonales se reconstruyen al expandir en O(d). El
+// único límite es la memoria de la frontera (max_bytes), no un tope artificial
+// de estados.
+//
+// A* usa h = filas restantes, con comprobación hacia adelante: si alguna fila
+// restante ya no tiene casillas libres, el nodo no lleva a solución y se poda
+// (h = infinito). Los nodos abiertos viven en un arena de bytes y la cola de
+// prioridad solo guarda (f, g, desplazamiento). Como a igual f sale primero el
+// nodo más profundo y más reciente, casi siempre es el último del arena y su
+// espacio se recupera al sacarlo.
+
+#ifndef NQUEENS_TREE_H
+#define NQUEENS_TREE_H
+
+#include "nqueens_bitboard.h"
+
+#include <cstdint>
+#include <queue>
+#include <vector>
+#include <algorithm>
+
+struct TreeSearchStats {
+    bool found = false;
+    bool truncated = false;      // Se alcanzó max_bytes (o el límite de expansiones de A*)
+    int levels = 0;              // Niveles completados (BFS)
+    long long expanded = 0;
+    long long generated = 0;
+    long long pruned = 0;        // Hijos descartados por la comprobación hacia adelante (A*)
+    size_t peak_nodes = 0;       // Mayor frontera / cola abierta
+    size_t peak_bytes = 0;       // Memoria máxima de la frontera empaquetada
+};
+
+// Máscaras de la fila `depth` a partir de las columnas empaquetadas de sus filas anteriores.
+struct QueenMasks {
+    uint64_t cols = 0, ld = 0, rd = 0;
+
+    QueenMasks() = default;
+    QueenMasks(const uint8_t *columns, int depth, uint64_t full) {
+        for (int r = 0; r < depth; ++r) {
+            uint64_t bit = 1ULL << columns[r];
+            cols |= bit;
+            ld = ((ld | bit) << 1) & full;
+            rd = (rd | bit) >> 1;
+        }
+    }
+    uint64_t free(uint64_t full) const { return full & ~(cols | ld | rd); }
+};
+
+/**
+ * @brief BFS por niveles sin visitados: cada nivel es un arreglo de bytes de `nivel` columnas por nodo.
+ * @param max_bytes Memoria máxima de las dos fronteras (actual y siguiente).
+ */
+inline TreeSearchStats nqueens_tree_bfs(int N, size_t max_bytes = (size_t)1 << 29) {
+    TreeSearchStats stats;
+    if (N < 1 || N > 64) return stats;
+    const uint64_t full = nqueens_full_mask(N);
+    std::vector<uint8_t> frontier, next; // Nivel 0: un nodo vacío (0 bytes)
+    size_t count = 1;
+
+    for (int depth = 0; depth < N; ++depth) {
+        next.clear();
+        size_t next_count = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const uint8_t *node = frontier.data() + i * depth;
+            QueenMasks masks(node, depth, full);
+            stats.expanded++;
+            for (uint64_t free = masks.free(full); free != 0; free &= free - 1) {
+                stats.generated++;
+                if (depth + 1 == N) { // Hijo en el último nivel: tablero completo
+                    stats.found = true;
+                    stats.levels = N;
+                    return stats;
+                }
+                next.insert(next.end(), node, node + depth);
+                next.push_back((uint8_t)__builtin_ctzll(free));
+                next_count++;
+            }
+            if (frontier.size() + next.size() > max_bytes) {
+                stats.truncated = true;
+                return stats;
+            }
+        }
+        frontier.swap(next);
+        count = next_count;
+        stats.levels = depth + 1;
+        stats.peak_nodes = std::max(stats.peak_nodes, count);
+        stats.peak_bytes = std::max(stats.peak_bytes, frontier.capacity());
+        if (count == 0) break; // Sin solución (N = 2, 3)
+    }
+    return stats;
+}
+
+/**
+ * @brief A* sin conjunto cerrado: h = filas restantes, con poda hacia adelante.
+ * @param max_expanded Límite de expansiones (tiempo); la memoria solo crece con la cola abierta.
+ * @param max_bytes Memoria máxima del arena de nodos abiertos.
+ */
+inline TreeSearchStats nqueens_tree_astar(int N, long long max_expanded = 5000000, size_t max_bytes = (size_t)1 << 29) {
+    TreeSearchStats stats;
+    if (N < 1 || N > 64) return stats;
+    const uint64_t full = nqueens_full_mask(N);
+    struct Open {
+        int f, g;
+        size_t offset; // Columnas del nodo en el arena (g bytes)
+        bool operator<(const Open &other) const {
+            if (f != other.f) return f > other.f;
+            if (g != other.g) return g < other.g; // A igual f, primero el más profundo
+            return offset < other.offset;         // ... y el más reciente: el arena se libera como una pila
+        }
+    };
+    std::vector<uint8_t> arena;
+    std::priority_queue<Open> open;
+    std::vector<uint8_t> child;
+    open.push({N, 0, 0});
+
+    // ¿Alguna fila restante se quedó sin casillas libres?
+    auto dead_end = [&](const QueenMasks &m, int depth) {
+        for (int k = 0; depth + k < N; ++k) {
+            uint64_t attacked = m.cols | ((m.ld << k) & full) | (m.rd >> k);
+            if ((full & ~attacked) == 0) return true;
+        }
+        return false;
+    };
+
+    while (!open.empty()) {
+        Open current = open.top();
+        open.pop();
+        if (current.g == N) {
+            stats.found = true;
+            break;
+        }
+        stats.expanded++;
+        child.assign(arena.begin() + current.offset, arena.begin() + current.offset + current.g);
+        if (current.offset + current.g == arena.size()) arena.resize(current.offset); // Era el último del arena
+        QueenMasks masks(child.data(), current.g, full);
+        child.push_back(0);
+        for (uint64_t free = masks.free(full); free != 0; free &= free - 1) {
+            stats.generated++;
+            uint64_t bit = free & (0 - free);
+            QueenMasks next;
+            next.cols = masks.cols | bit;
+            next.ld = ((masks.ld | bit) << 1) & full;
+            next.rd = (masks.rd | bit) >> 1;
+            if (current.g + 1 < N && dead_end(next, current.g + 1)) {
+                stats.pruned++;
+                continue;
+            }
+            child.back() = (uint8_t)__builtin_ctzll(bit);
+            open.push({N, current.g + 1, arena.size()}); // f = g + (N - g)
+            arena.insert(arena.end(), child.begin(), child.end());
+        }
+        stats.peak_nodes = std::max(stats.peak_nodes, open.size());
+        stats.peak_bytes = std::max(stats.peak_bytes, arena.size());
+        if (arena.size() > max_bytes || stats.expanded >= max_expanded) {
+            stats.truncated = true;
+            break;
+        }
+    }
+    return stats;
+}
+
+#endif // NQUEENS_TREE_H
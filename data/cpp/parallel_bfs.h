@@ -0,0 +1,223 @@
+// --- BFS paralelo síncrono por niveles con fronteras empaquetadas ---
+//
+// La frontera de cada nivel es un vector contiguo de estados empaquetados.
+// Cada nivel tiene dos fases separadas por barreras:
+//   1. Expansión: cada hilo expande un trozo contiguo de la frontera y reparte
+//      los sucesores en cubetas según el hilo dueño de su hash.
+//   2. Deduplicación: cada hilo inserta las cubetas que le pertenecen en su
+//      partición del conjunto de visitados (sin cerrojos, nadie más la toca).
+// Luego las partes nuevas se concatenan en la siguiente frontera y se
+// intercambian los búferes. Por nodo solo se guarda el estado empaquetado.
+//
+// Checkpoints: con SEARCH_CHECKPOINT_FILE definido (o un CheckpointConfig
+// explícito) se vuelcan frontera, visitados y contadores al cerrar un nivel,
+// como mucho cada interval_seconds. Una ejecución posterior con la misma
+// instancia (ver checkpoint_fingerprint) reanuda desde ese nivel (con cualquier número de hilos). El archivo
+// se borra cuando la búsqueda termina y se conserva si se corta por el límite.
+
+#ifndef PARALLEL_BFS_H
+#define PARALLEL_BFS_H
+
+#include "search_core.h"
+#include "checkpoint.h"
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+
+// Barrera reutilizable para un número fijo de hilos (std::barrier es de C++20).
+class LevelBarrier {
+public:
+    explicit LevelBarrier(int count) : count_(count) {}
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        long long gen = generation_;
+        if (++waiting_ == count_) {
+            waiting_ = 0;
+            generation_++;
+            cv_.notify_all();
+        } else {
+            cv_.wait(lock, [&] { return gen != generation_; });
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    int count_;
+    int waiting_ = 0;
+    long long generation_ = 0;
+};
+
+struct ParallelBfsStats : SearchStats {
+    int levels = 0;             // Niveles completados
+    long long visited = 0;      // Estados distintos descubiertos
+    size_t peak_frontier = 0;   // Mayor frontera (en estados)
+    int threads = 0;
+    int resumed_level = -1;     // Nivel desde el que se reanudó (-1 = desde el inicio)
+    int checkpoints = 0;        // Checkpoints escritos
+};
+
+/**
+ * @brief BFS síncrono por niveles con expansión en paralelo y deduplicación particionada por hash.
+ * @param num_threads Número de hilos (0 = todos los núcleos disponibles).
+ * @param max_states Límite de estados visitados (como MAX_NODES en la versión secuencial).
+ * @param checkpoint Dónde y cada cuánto volcar el progreso (por defecto, desde el entorno).
+ */
+template <class P>
+ParallelBfsStats parallel_bfs(const P &problem, int num_threads = 0, long long max_states = 5000000,
+                              const CheckpointConfig &checkpoint = CheckpointConfig::from_env()) {
+    using State = typename P::State;
+    using Table = StateTable<State, char, ProblemHasher<P>>;
+    using Clock = std::chrono::steady_clock;
+
+    if (num_threads <= 0) num_threads = (int)std::max(1u, std::thread::hardware_concurrency());
+    const int T = num_threads;
+    ProblemHasher<P> hasher{&problem};
+    auto owner = [&](const State &s) { return (int)((hasher(s) >> 32) % (uint64_t)T); };
+
+    ParallelBfsStats stats;
+    stats.threads = T;
+    std::vector<Table> visited(T, Table(hasher));
+    std::vector<std::vector<std::vector<State>>> buckets(T, std::vector<std::vector<State>>(T));
+    std::vector<std::vector<State>> next_parts(T);
+    std::vector<long long> expanded(T, 0), generated(T, 0);
+    std::vector<State> frontier, next_frontier;
+    std::atomic<bool> goal_found{false};
+    bool stop = false;
+
+    const uint64_t fingerprint = checkpoint_fingerprint(problem, "parallel_bfs");
+    long long base_expanded = 0, base_generated = 0;
+    auto save_checkpoint = [&]() {
+        std::vector<State> all_visited;
+        for (auto &t : visited) t.for_each([&](const State &s, char) { all_visited.push_back(s); });
+        // Contadores: niveles, expandidos, generados, frontera máxima.
+        long long counters[4] = {stats.levels, base_expanded, base_generated, (long long)stats.peak_frontier};
+        for (int i = 0; i < T; ++i) {
+            counters[1] += expanded[i];
+            counters[2] += generated[i];
+        }
+        CheckpointWriter writer(checkpoint.path, sizeof(State), fingerprint);
+        writer.write(counters);
+        writer.write_vector(frontier);
+        writer.write_vector(all_visited);
+        if (writer.commit()) stats.checkpoints++;
+    };
+    auto load_checkpoint = [&]() {
+        CheckpointReader reader(checkpoint.path, sizeof(State), fingerprint);
+        long long counters[4];
+        std::vector<State> all_visited;
+        if (!reader.read(counters) || !reader.read_vector(frontier) || !reader.read_vector(all_visited)) {
+            frontier.clear();
+            return false;
+        }
+        stats.levels = stats.resumed_level = (int)counters[0];
+        base_expanded = counters[1];
+        base_generated = counters[2];
+        stats.peak_frontier = (size_t)counters[3];
+        // Los dueños dependen del número de hilos: se reparten de nuevo al cargar.
+        for (const State &s : all_visited) visited[owner(s)].insert(s, 1);
+        return true;
+    };
+
+    if (checkpoint.path == nullptr || !load_checkpoint()) {
+        State start = problem.initial();
+        visited[owner(start)].insert(start, 1);
+        frontier.push_back(start);
+        if (problem.is_goal(start)) {
+            stats.found = true;
+            stats.cost = 0;
+            stop = true;
+        }
+    }
+    auto last_checkpoint = Clock::now();
+
+    LevelBarrier barrier(T);
+    auto worker = [&](int id) {
+        while (true) {
+            barrier.wait(); // Inicio de nivel: la frontera y "stop" ya están publicados
+            if (stop) return;
+
+            // Fase 1: expandir un trozo contiguo de la frontera.
+            size_t len = frontier.size();
+            size_t lo = len * id / T, hi = len * (id + 1) / T;
+            int depth = stats.levels;
+            for (size_t i = lo; i < hi; ++i) {
+                expanded[id]++;
+                SEARCH_TRACE(TRACE_EXPAND, hasher(frontier[i]), depth, depth, -1);
+                problem.expand(frontier[i], [&](const State &next, int) {
+                    generated[id]++;
+                    SEARCH_TRACE(TRACE_GENERATE, hasher(next), depth + 1, depth + 1, -1);
+                    if (problem.is_goal(next)) {
+                        SEARCH_TRACE(TRACE_GOAL, hasher(next), depth + 1, depth + 1, 0);
+                        goal_found.store(true, std::memory_order_relaxed);
+                    }
+                    buckets[id][owner(next)].push_back(next);
+                });
+            }
+            barrier.wait();
+
+            // Fase 2: deduplicar las cubetas propias contra la partición local de visitados.
+            next_parts[id].clear();
+            for (int p = 0; p < T; ++p) {
+                for (const State &s : buckets[p][id]) {
+                    if (visited[id].insert(s, 1).second) next_parts[id].push_back(s);
+                    else SEARCH_TRACE(TRACE_PRUNE, hasher(s), stats.levels + 1, stats.levels + 1, -1);
+                }
+                buckets[p][id].clear();
+            }
+            barrier.wait();
+
+            // Fase 3 (hilo 0): concatenar la siguiente frontera e intercambiar búferes.
+            if (id == 0) {
+                next_frontier.clear();
+                for (auto &part : next_parts) next_frontier.insert(next_frontier.end(), part.begin(), part.end());
+                frontier.swap(next_frontier);
+                stats.levels++;
+                stats.peak_frontier = std::max(stats.peak_frontier, frontier.size());
+                long long total = 0;
+                for (auto &t : visited) total += t.size();
+                if (goal_found.load()) {
+                    stats.found = true;
+                    stats.cost = stats.levels;
+                    stop = true;
+                } else if (frontier.empty()) {
+                    stop = true;
+                } else if (total > max_states) {
+                    stats.truncated = true;
+                    stop = true;
+                }
+                if (checkpoint.path != nullptr) {
+                    double elapsed = std::chrono::duration<double>(Clock::now() - last_checkpoint).count();
+                    if (stats.truncated || (!stop && elapsed >= checkpoint.interval_seconds)) {
+                        save_checkpoint();
+                        last_checkpoint = Clock::now();
+                    } else if (stop) {
+                        std::remove(checkpoint.path); // Búsqueda terminada: ya no hay nada que reanudar
+                    }
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < T; ++i) threads.emplace_back(worker, i);
+    worker(0);
+    for (auto &t : threads) t.join();
+
+    stats.expanded = base_expanded;
+    stats.generated = base_generated;
+    for (int i = 0; i < T; ++i) {
+        stats.expanded += expanded[i];
+        stats.generated += generated[i];
+        stats.visited += visited[i].size();
+    }
+    return stats;
+}
+
+#endif // PARALLEL_BFS_H
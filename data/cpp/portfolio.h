@@ -0,0 +1,159 @@
+// --- Carrera de algoritmos (portafolio) con cancelación del resto ---
+//
+// Lanza cada algoritmo aplicable en su propio hilo y se queda con la primera
+// solución válida. El ganador activa un StopToken compartido; los demás lo ven
+// y terminan en cuanto pueden, devolviendo el progreso que llevaban. Así la
+// latencia de extremo a extremo es la del mejor algoritmo para cada instancia.
+//
+// Cancelación de los motores del núcleo sin tocarlos: CancellableProblem<P>
+// envuelve el problema y, una vez pedida la parada, deja de generar sucesores
+// (expand, expand_reverse y moves no visitan nada). Cada motor agota entonces
+// su frontera y devuelve sus estadísticas. El recocido simulado mira el mismo
+// indicador a través de SaOptions::stop.
+//
+// Se activa en las simulaciones con SEARCH_PORTFOLIO=1.
+
+#ifndef PORTFOLIO_H
+#define PORTFOLIO_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+class StopToken {
+public:
+    void request_stop() { flag_.store(true, std::memory_order_relaxed); }
+    bool stop_requested() const { return flag_.load(std::memory_order_relaxed); }
+    const std::atomic<bool> *flag() const { return &flag_; }
+
+private:
+    std::atomic<bool> flag_{false};
+};
+
+/**
+ * @brief Problema del núcleo que deja de generar sucesores cuando se pide la parada.
+ */
+template <class P>
+struct CancellableProblem : P {
+    CancellableProblem(const P &problem, const StopToken &token) : P(problem), stop(&token) {}
+
+    template <class Visit>
+    void expand(const typename P::State &s, Visit &&visit) const {
+        if (!stop->stop_requested()) P::expand(s, visit);
+    }
+    template <class Visit>
+    void expand_reverse(const typename P::State &s, Visit &&visit) const {
+        if (!stop->stop_requested()) P::expand_reverse(s, visit);
+    }
+    template <class MoveT>
+    int moves(const typename P::State &s, MoveT *out) const {
+        return stop->stop_requested() ? 0 : P::moves(s, out);
+    }
+
+    const StopToken *stop;
+};
+
+// Lo que devuelve cada algoritmo del portafolio.
+struct PortfolioOutcome {
+    bool found = false;
+    long long progress = 0;   // Nodos expandidos / iteraciones hechas hasta terminar
+    std::string note = "";    // Detalle opcional (costo, motivo de inviabilidad, ...)
+};
+
+struct PortfolioEntry {
+    std::string name;
+    std::function<PortfolioOutcome(const StopToken &)> run;
+};
+
+struct PortfolioReport {
+    std::string name;
+    PortfolioOutcome outcome;
+    double duration_ms = 0;   // Hasta que el algoritmo devolvió el control
+    bool cancelled = false;   // Terminó por la parada, sin solución propia
+};
+
+struct PortfolioResult {
+    int winner = -1;          // Índice en reports (-1 = nadie encontró solución)
+    double winner_ms = 0;     // Latencia hasta la primera solución
+    double total_ms = 0;      // Hasta que terminaron todos los hilos
+    std::vector<PortfolioReport> reports;
+};
+
+// ¿Se pidió el modo portafolio (SEARCH_PORTFOLIO=1) en lugar de la comparación completa?
+inline bool portfolio_mode() {
+    const char *mode = std::getenv("SEARCH_PORTFOLIO");
+    return mode != nullptr && *mode != '\0' && *mode != '0';
+}
+
+// Hilos para cada motor paralelo cuando comparten la máquina con el resto del portafolio.
+inline int portfolio_threads_per_entry(size_t entries) {
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    return (int)std::max<size_t>(1, cores / std::max<size_t>(1, entries));
+}
+
+/**
+ * @brief Corre todos los algoritmos en paralelo y cancela al resto con el primero que resuelve.
+ */
+inline PortfolioResult run_portfolio(const std::vector<PortfolioEntry> &entries) {
+    using Clock = std::chrono::high_resolution_clock;
+    auto ms_since = [](Clock::time_point t0) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - t0).count() / 1000.0;
+    };
+
+    PortfolioResult result;
+    result.reports.resize(entries.size());
+    StopToken token;
+    std::atomic<int> winner{-1};
+    auto start = Clock::now();
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        threads.emplace_back([&, i] {
+            PortfolioReport &report = result.reports[i];
+            report.name = entries[i].name;
+            report.outcome = entries[i].run(token);
+            report.duration_ms = ms_since(start);
+            int expected = -1;
+            if (report.outcome.found && winner.compare_exchange_strong(expected, (int)i)) {
+                result.winner_ms = report.duration_ms;
+                token.request_stop();
+            } else if (!report.outcome.found && token.stop_requested()) {
+                report.cancelled = true;
+            }
+        });
+    }
+    for (auto &t : threads) t.join();
+
+    result.winner = winner.load();
+    result.total_ms = ms_since(start);
+    return result;
+}
+
+/**
+ * @brief Tabla del portafolio (estado y progreso de cada algoritmo) y línea "> Algoritmo:" del ganador.
+ */
+inline void print_portfolio(const PortfolioResult &result, std::ostream &out = std::cout) {
+    out << std::fixed << std::setprecision(4) << "\n--- Portafolio: primera solución válida, el resto se cancela ---" << std::endl;
+    for (const PortfolioReport &r : result.reports) {
+        const char *state = r.outcome.found ? "Resuelto " : (r.cancelled ? "Cancelado" : "Sin éxito");
+        out << "| " << std::setw(42) << std::left << r.name << " | " << std::setw(11) << std::right << r.duration_ms
+            << " ms | " << state << " | progreso " << std::setw(10) << r.outcome.progress << " |"
+            << (r.outcome.note.empty() ? "" : " " + r.outcome.note) << std::endl;
+    }
+    if (result.winner >= 0) {
+        out << "\n🏆 PRIMERA SOLUCIÓN DEL PORTAFOLIO (todos terminados en " << result.total_ms << " ms):" << std::endl;
+        out << "   > Algoritmo: " << result.reports[result.winner].name << std::endl;
+        out << "   > Tiempo: " << result.winner_ms << " ms" << std::endl;
+    } else {
+        out << "\n   > Algoritmo: Ninguno (Fallo)" << std::endl;
+    }
+}
+
+#endif // PORTFOLIO_H
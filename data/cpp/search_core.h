@@ -0,0 +1,143 @@
+// --- Núcleo de búsqueda genérico compartido por las simulaciones ---
+//
+// Los motores de búsqueda (HDA*, ...) trabajan sobre cualquier "problema" que
+// cumpla la siguiente interfaz (duck typing, sin herencia):
+//
+//   struct MiProblema {
+//       using State = ...;                        // copiable, con operator==
+//       State initial() const;                    // estado inicial
+//       bool is_goal(const State &s) const;       // test de objetivo
+//       int heuristic(const State &s) const;      // h(n) admisible (SEARCH_INF = callejón sin salida)
+//       uint64_t hash(const State &s) const;      // hash del estado (se mezcla con mix_hash)
+//       template <class Visit>
+//       void expand(const State &s, Visit &&visit) const; // visit(sucesor, costo_del_paso)
+//   };
+//
+// Los estados deben ser pequeños y empaquetados (p. ej. uint64_t): se copian
+// entre hilos y se guardan en tablas planas, nunca en std::set / std::map.
+//
+// Todos los motores emiten eventos SEARCH_TRACE (ver search_trace.h).
+
+#ifndef SEARCH_CORE_H
+#define SEARCH_CORE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <limits>
+
+#include "search_trace.h"
+
+// Valor "infinito" para costos y heurísticas (estado sin salida).
+const int SEARCH_INF = std::numeric_limits<int>::max() / 4;
+
+/**
+ * @brief Mezclador de bits (splitmix64) para repartir bien los hashes de estados empaquetados.
+ */
+inline uint64_t mix_hash(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Estadísticas comunes que devuelven todos los motores del núcleo.
+struct SearchStats {
+    bool found = false;        // ¿Se encontró un estado objetivo?
+    bool truncated = false;    // ¿Se detuvo por el límite de nodos antes de probar optimalidad?
+    int cost = -1;             // Costo de la mejor solución encontrada (-1 si no hay)
+    long long expanded = 0;    // Nodos expandidos
+    long long generated = 0;   // Sucesores generados
+};
+
+// Estado de un motor que se avanza por pasos (ver stepper.h).
+enum StepStatus : uint8_t {
+    STEP_RUNNING,    // Quedan nodos/iteraciones: se puede volver a llamar a step()
+    STEP_FOUND,      // Encontró solución
+    STEP_EXHAUSTED,  // Espacio agotado o límite propio alcanzado, sin solución
+};
+
+// Adaptador que expone el hash de un problema como functor.
+template <class P>
+struct ProblemHasher {
+    const P *problem;
+    uint64_t operator()(const typename P::State &s) const { return mix_hash(problem->hash(s)); }
+};
+
+/**
+ * @brief Tabla hash de direccionamiento abierto (sondeo lineal) para estados empaquetados.
+ *
+ * Sustituye a std::map<State, int> en las listas cerradas: una sola reserva
+ * contigua, sin nodos por elemento y con búsqueda en O(1) esperado.
+ */
+template <class State, class Value, class Hasher>
+class StateTable {
+public:
+    explicit StateTable(Hasher hasher, size_t initial_capacity = 1024) : hasher_(hasher) {
+        size_t cap = 16;
+        while (cap < initial_capacity * 2) cap <<= 1;
+        keys_.resize(cap);
+        values_.resize(cap);
+        used_.assign(cap, 0);
+    }
+
+    size_t size() const { return size_; }
+
+    // Devuelve un puntero al valor asociado a s, o nullptr si no existe.
+    Value *find(const State &s) {
+        size_t mask = keys_.size() - 1;
+        for (size_t i = hasher_(s) & mask; used_[i]; i = (i + 1) & mask) {
+            if (keys_[i] == s) return &values_[i];
+        }
+        return nullptr;
+    }
+
+    // Inserta (s, v) si s no existe. Devuelve {puntero al valor, insertado?}.
+    std::pair<Value *, bool> insert(const State &s, const Value &v) {
+        if ((size_ + 1) * 10 > keys_.size() * 7) grow();
+        size_t mask = keys_.size() - 1;
+        size_t i = hasher_(s) & mask;
+        for (; used_[i]; i = (i + 1) & mask) {
+            if (keys_[i] == s) return {&values_[i], false};
+        }
+        used_[i] = 1;
+        keys_[i] = s;
+        values_[i] = v;
+        size_++;
+        return {&values_[i], true};
+    }
+
+    // Recorre todas las entradas: f(estado, valor). Se usa para volcar checkpoints.
+    template <class F>
+    void for_each(F &&f) const {
+        for (size_t i = 0; i < keys_.size(); ++i) {
+            if (used_[i]) f(keys_[i], values_[i]);
+        }
+    }
+
+private:
+    void grow() {
+        std::vector<State> old_keys;
+        std::vector<Value> old_values;
+        std::vector<uint8_t> old_used;
+        old_keys.swap(keys_);
+        old_values.swap(values_);
+        old_used.swap(used_);
+        keys_.resize(old_keys.size() * 2);
+        values_.resize(old_keys.size() * 2);
+        used_.assign(old_keys.size() * 2, 0);
+        size_ = 0;
+        for (size_t i = 0; i < old_keys.size(); ++i) {
+            if (old_used[i]) insert(old_keys[i], old_values[i]);
+        }
+    }
+
+    Hasher hasher_;
+    std::vector<State> keys_;
+    std::vector<Value> values_;
+    std::vector<uint8_t> used_;
+    size_t size_ = 0;
+};
+
+#endif // SEARCH_CORE_H
@@ -0,0 +1,205 @@
+// --- Traza binaria de expansiones para los motores del núcleo de búsqueda ---
+//
+// Activación: definir la variable de entorno SEARCH_TRACE_FILE=<ruta>. Sin ella
+// cada punto de traza cuesta una sola comparación (y los argumentos ni se
+// evalúan). Con -DSEARCH_TRACE_DISABLED los puntos desaparecen al compilar.
+//
+// Cada evento ocupa 16 bytes (hash del estado, profundidad, g, h, tipo, hilo).
+// Cada hilo escribe en su propio bloque de 4096 eventos sin sincronización;
+// los bloques llenos pasan a un hilo escritor que los vuelca al archivo en
+// segundo plano. Si el escritor se atrasa más de MAX_QUEUED bloques, los
+// eventos nuevos se descartan (y se cuentan) en lugar de frenar la búsqueda.
+//
+// Formato: cabecera {"STRC", versión, tamaño de evento} y luego bloques
+// {hilo, cantidad, eventos[cantidad]}. Ver tools/trace_decode.cpp. El hilo del
+// bloque es el identificador completo (32 bits); el byte de cada evento solo
+// guarda sus 8 bits bajos para no pasar de 16 bytes.
+//
+// Los bucles heredados de cada familia (run_bfs / run_a_star sobre vectores y
+// std::set) también se trazan; trace_hash_value resume sus estados en 64 bits.
+
+#ifndef SEARCH_TRACE_H
+#define SEARCH_TRACE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <type_traits>
+
+enum TraceEventType : uint8_t {
+    TRACE_EXPAND = 1,    // Se expande un nodo
+    TRACE_GENERATE = 2,  // Se genera un sucesor
+    TRACE_PRUNE = 3,     // Sucesor descartado (duplicado, f > umbral, callejón sin salida)
+    TRACE_GOAL = 4,      // Se alcanza un objetivo
+    TRACE_BACKTRACK = 5  // Se deshace un movimiento (búsquedas en profundidad)
+};
+
+struct TraceEvent {
+    uint64_t state_hash;
+    uint16_t depth;
+    int16_t g;
+    int16_t h;
+    uint8_t type;
+    uint8_t thread;
+};
+static_assert(sizeof(TraceEvent) == 16, "TraceEvent debe ocupar 16 bytes");
+
+const uint32_t TRACE_MAGIC = 0x43525453; // "STRC" en little-endian
+const uint32_t TRACE_VERSION = 1;
+
+struct TraceChunk {
+    static const uint32_t CAPACITY = 4096;
+    uint32_t thread = 0;
+    uint32_t count = 0;
+    TraceEvent events[CAPACITY];
+};
+
+class SearchTracer {
+public:
+    static const size_t MAX_QUEUED = 64; // ~4 MB de eventos pendientes como máximo
+
+    static SearchTracer &instance() {
+        static SearchTracer tracer;
+        return tracer;
+    }
+
+    bool enabled() const { return file_ != nullptr; }
+
+    // Entrega un bloque lleno (o el último parcial de un hilo) al escritor.
+    void submit(TraceChunk *chunk) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queue_.size() >= MAX_QUEUED) {
+            dropped_ += chunk->count;
+            chunk->count = 0;
+            free_.push_back(chunk);
+            return;
+        }
+        queue_.push_back(chunk);
+        cv_.notify_one();
+    }
+
+    TraceChunk *acquire(uint32_t thread) {
+        TraceChunk *chunk = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!free_.empty()) {
+                chunk = free_.back();
+                free_.pop_back();
+            }
+        }
+        if (chunk == nullptr) chunk = new TraceChunk;
+        chunk->thread = thread;
+        chunk->count = 0;
+        return chunk;
+    }
+
+    uint32_t next_thread_id() { return next_thread_.fetch_add(1); }
+
+    ~SearchTracer() {
+        if (!enabled()) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+            cv_.notify_one();
+        }
+        writer_.join();
+        std::fclose(file_);
+        std::fprintf(stderr, "[traza] %lld eventos escritos, %lld descartados\n", written_, dropped_);
+        for (TraceChunk *c : free_) delete c;
+    }
+
+private:
+    SearchTracer() {
+        const char *path = std::getenv("SEARCH_TRACE_FILE");
+        if (path == nullptr || *path == '\0') return;
+        file_ = std::fopen(path, "wb");
+        if (file_ == nullptr) return;
+        uint32_t header[3] = {TRACE_MAGIC, TRACE_VERSION, (uint32_t)sizeof(TraceEvent)};
+        std::fwrite(header, sizeof(header), 1, file_);
+        writer_ = std::thread([this] { write_loop(); });
+    }
+
+    void write_loop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [&] { return stopping_ || !queue_.empty(); });
+            if (queue_.empty() && stopping_) return;
+            TraceChunk *chunk = queue_.front();
+            queue_.pop_front();
+            lock.unlock();
+            std::fwrite(&chunk->thread, sizeof(uint32_t), 2, file_); // hilo + cantidad
+            std::fwrite(chunk->events, sizeof(TraceEvent), chunk->count, file_);
+            lock.lock();
+            written_ += chunk->count;
+            free_.push_back(chunk);
+        }
+    }
+
+    std::FILE *file_ = nullptr;
+    std::thread writer_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<TraceChunk *> queue_;
+    std::vector<TraceChunk *> free_;
+    std::atomic<uint32_t> next_thread_{0};
+    bool stopping_ = false;
+    long long written_ = 0;
+    long long dropped_ = 0;
+};
+
+// Bloque actual de cada hilo; al terminar el hilo se entrega el bloque parcial.
+struct TraceLocal {
+    TraceChunk *chunk = nullptr;
+    ~TraceLocal() {
+        if (chunk != nullptr && chunk->count > 0) SearchTracer::instance().submit(chunk);
+    }
+};
+
+// Hash de estados de los bucles heredados: enteros y vectores (anidados) de enteros o bool.
+template <class T>
+inline uint64_t trace_hash_value(const T &value) {
+    static_assert(std::is_integral<T>::value, "trace_hash_value: solo enteros o vectores de enteros");
+    return (uint64_t)value;
+}
+
+template <class T>
+inline uint64_t trace_hash_value(const std::vector<T> &values) {
+    uint64_t h = values.size();
+    for (const T &v : values) { // const T& también sirve para vector<bool> (copia el bit)
+        h ^= trace_hash_value(v) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+    }
+    return h;
+}
+
+inline bool trace_enabled() {
+    static const bool on = SearchTracer::instance().enabled();
+    return on;
+}
+
+inline void trace_record(TraceEventType type, uint64_t state_hash, int depth, int g, int h) {
+    thread_local TraceLocal local;
+    SearchTracer &tracer = SearchTracer::instance();
+    if (local.chunk == nullptr) local.chunk = tracer.acquire(tracer.next_thread_id());
+    TraceChunk *c = local.chunk;
+    c->events[c->count++] = {state_hash, (uint16_t)depth, (int16_t)g, (int16_t)h, (uint8_t)type, (uint8_t)c->thread};
+    if (c->count == TraceChunk::CAPACITY) {
+        uint32_t thread = c->thread;
+        tracer.submit(c);
+        local.chunk = tracer.acquire(thread);
+    }
+}
+
+#ifdef SEARCH_TRACE_DISABLED
+#define SEARCH_TRACE(type, hash, depth, g, h) do { } while (0)
+#else
+#define SEARCH_TRACE(type, hash, depth, g, h) \
+    do { if (trace_enabled()) trace_record((type), (hash), (depth), (g), (h)); } while (0)
+#endif
+
+#endif // SEARCH_TRACE_H
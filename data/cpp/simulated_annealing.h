@@ -0,0 +1,171 @@
+// --- Recocido simulado genérico con evaluación incremental (delta O(1)) ---
+//
+// A diferencia de Hill Climbing, que se detiene en el primer óptimo local y
+// vuelve a puntuar el estado completo por cada candidato, aquí el problema
+// mantiene sus propias estructuras incrementales y solo informa cuánto cambia
+// el costo con un movimiento propuesto (duck typing, sin herencia):
+//
+//   struct MiProblemaSA {
+//       using Move = ...;
+//       long long cost() const;                 // costo actual (0 = solución)
+//       Move propose(SaRng &rng) const;         // movimiento aleatorio
+//       long long delta(const Move &m) const;   // cambio de costo si se aplica m, en O(1)
+//       void apply(const Move &m);              // aplica m y actualiza los contadores
+//   };
+//
+// El enfriamiento es intercambiable (geométrico, lineal, Lundy-Mees) y si la
+// búsqueda se estanca se "recalienta" a una fracción de la temperatura inicial.
+
+#ifndef SIMULATED_ANNEALING_H
+#define SIMULATED_ANNEALING_H
+
+#include "anytime_profile.h"
+#include "search_core.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+// Generador xorshift64*: barato y suficiente para proponer movimientos.
+class SaRng {
+public:
+    explicit SaRng(uint64_t seed) : state_(seed ? seed : 0x9e3779b97f4a7c15ULL) {}
+
+    uint64_t next() {
+        state_ ^= state_ >> 12;
+        state_ ^= state_ << 25;
+        state_ ^= state_ >> 27;
+        return state_ * 0x2545f4914f6cdd1dULL;
+    }
+    // Entero uniforme en [0, n).
+    int below(int n) { return (int)(((next() >> 32) * (uint64_t)n) >> 32); }
+    // Real uniforme en [0, 1).
+    double uniform() { return (next() >> 11) * (1.0 / 9007199254740992.0); }
+
+private:
+    uint64_t state_;
+};
+
+// --- Esquemas de enfriamiento: t0 y el paso t -> next(t) ---
+
+struct GeometricCooling {
+    double t0 = 2.0;
+    double alpha = 0.9999;
+    double next(double t) const { return t * alpha; }
+};
+
+struct LinearCooling {
+    double t0 = 2.0;
+    long long steps = 1000000;   // Iteraciones hasta llegar a t_min
+    double next(double t) const { return t - t0 / steps; }
+};
+
+// t <- t / (1 + beta * t): baja rápido al principio y muy lento al final.
+struct LundyMeesCooling {
+    double t0 = 2.0;
+    double beta = 1e-4;
+    double next(double t) const { return t / (1.0 + beta * t); }
+};
+
+struct SaOptions {
+    long long max_iterations = 1000000;
+    long long target_cost = 0;       // Parar al alcanzar este costo
+    double t_min = 1e-3;             // Piso de temperatura
+    long long reheat_after = 0;      // Iteraciones sin mejorar antes de recalentar (0 = nunca)
+    double reheat_factor = 0.5;      // Temperatura tras recalentar = t0 * factor
+    uint64_t seed = 1;
+    const std::atomic<bool> *stop = nullptr; // Cancelación externa (p. ej. portafolio), cada 1024 iteraciones
+};
+
+struct SaStats {
+    bool found = false;          // ¿Se alcanzó target_cost?
+    long long best_cost = 0;
+    long long final_cost = 0;
+    long long iterations = 0;
+    long long accepted = 0;      // Movimientos aceptados
+    long long uphill = 0;        // ... de ellos, empeorando el costo
+    int reheats = 0;
+};
+
+/**
+ * @brief Recocido simulado como máquina de estados: step(k) hace hasta k iteraciones.
+ *
+ * Permite pausarlo, abortarlo o intercalarlo con otros motores (stepper.h).
+ */
+template <class P, class Cooling>
+class SaStepper {
+public:
+    SaStepper(P &problem, const Cooling &cooling, const SaOptions &options, AnytimeProfile *profile = nullptr)
+        : problem_(problem), cooling_(cooling), options_(options), profile_(profile), rng_(options.seed),
+          cost_(problem.cost()), t_(cooling.t0) {
+        stats_.best_cost = stats_.final_cost = cost_;
+        stats_.found = cost_ <= options_.target_cost;
+        if (profile_ != nullptr) profile_->record(cost_);
+    }
+
+    StepStatus step(long long budget) {
+        for (; budget > 0 && status() == STEP_RUNNING; --budget) {
+            stats_.iterations++;
+            auto move = problem_.propose(rng_);
+            long long d = problem_.delta(move);
+            if (d <= 0 || rng_.uniform() < std::exp(-(double)d / t_)) {
+                problem_.apply(move);
+                cost_ += d;
+                stats_.accepted++;
+                if (d > 0) stats_.uphill++;
+            }
+            if (cost_ < stats_.best_cost) {
+                stats_.best_cost = cost_;
+                since_improvement_ = 0;
+                if (profile_ != nullptr) profile_->record(cost_);
+            } else if (options_.reheat_after > 0 && ++since_improvement_ >= options_.reheat_after) {
+                t_ = std::max(t_, cooling_.t0 * options_.reheat_factor);
+                since_improvement_ = 0;
+                stats_.reheats++;
+                continue;
+            }
+            t_ = std::max(options_.t_min, cooling_.next(t_));
+        }
+        stats_.final_cost = cost_;
+        stats_.found = stats_.best_cost <= options_.target_cost;
+        return status();
+    }
+
+    StepStatus status() const {
+        if (cost_ <= options_.target_cost) return STEP_FOUND;
+        return stats_.iterations < options_.max_iterations ? STEP_RUNNING : STEP_EXHAUSTED;
+    }
+    long long work() const { return stats_.iterations; }
+    const SaStats &stats() const { return stats_; }
+
+private:
+    P &problem_;
+    Cooling cooling_;
+    SaOptions options_;
+    AnytimeProfile *profile_;
+    SaRng rng_;
+    SaStats stats_;
+    long long cost_;
+    double t_;
+    long long since_improvement_ = 0;
+};
+
+/**
+ * @brief Recocido simulado sobre un problema con delta incremental.
+ * @param problem Estado mutable del problema (queda en el último estado visitado).
+ * @param cooling Esquema de enfriamiento (GeometricCooling, LinearCooling, LundyMeesCooling).
+ * @param profile Curva opcional mejor-costo vs. tiempo.
+ */
+template <class P, class Cooling>
+SaStats simulated_annealing(P &problem, const Cooling &cooling, const SaOptions &options,
+                            AnytimeProfile *profile = nullptr) {
+    SaStepper<P, Cooling> stepper(problem, cooling, options, profile);
+    // Bloques de 1024 iteraciones: entre bloque y bloque se consulta la cancelación externa.
+    while (stepper.step(1024) == STEP_RUNNING) {
+        if (options.stop != nullptr && options.stop->load(std::memory_order_relaxed)) break;
+    }
+    return stepper.stats();
+}
+
+#endif // SIMULATED_ANNEALING_H
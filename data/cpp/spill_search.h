@@ -0,0 +1,313 @@
+// --- Búsqueda primero-el-mejor con memoria acotada y frontera en disco ---
+//
+// La lista abierta vive en RAM mientras cabe en el presupuesto. Al superarlo,
+// la mitad "fría" (los nodos con mayor f) se ordena y se escribe como una
+// corrida en un archivo temporal. Al extraer el siguiente nodo se mezcla en
+// orden de f el montículo en memoria con la cabeza de cada corrida en disco,
+// así que el orden de expansión es el mismo que el de A*/BFS sin límite.
+//
+// Presupuesto: cada corrida abierta retiene en RAM su búfer de lectura (el
+// archivo va sin búfer de stdio); eso se descuenta del presupuesto antes de
+// decidir cuántos nodos caben en el montículo. Los búferes de corridas ocupan
+// como mucho un cuarto del presupuesto: su tamaño y el abanico (fan-in, hasta
+// MAX_FAN_IN corridas abiertas) salen de esa cuota. Al llegar al fan-in se
+// mezclan todas en una sola, descartando de paso las entradas que ya quedaron
+// obsoletas. Las cabezas de las corridas van en un montículo propio,
+// así que extraer cuesta O(log corridas).
+//
+// Si no se puede crear o escribir un archivo temporal, los nodos fríos se
+// quedan en RAM (por encima del presupuesto) y se marca spill_failed. Si falla
+// una lectura o una mezcla se pueden haber perdido nodos: además se marca
+// truncated, porque un "no encontrado" ya no es concluyente.
+//
+// Solo la frontera se vuelca a disco; la lista cerrada es una StateTable
+// compacta. Los estados deben ser trivialmente copiables (se escriben tal cual).
+
+#ifndef SPILL_SEARCH_H
+#define SPILL_SEARCH_H
+
+#include "search_core.h"
+
+#include <cstdio>
+#include <queue>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <type_traits>
+
+// Estadísticas del modo con memoria acotada.
+struct SpillStats : SearchStats {
+    long long spilled_nodes = 0;   // Nodos escritos a disco
+    int runs = 0;                  // Corridas ordenadas creadas (sin contar las de mezcla)
+    int merges = 0;                // Mezclas de corridas al llegar al fan-in
+    long long dropped_on_merge = 0; // Entradas obsoletas descartadas al mezclar
+    size_t peak_in_memory = 0;     // Máximo de nodos de la frontera en RAM
+    size_t peak_resident_bytes = 0; // Máximo de montículo + búferes de corridas
+    bool spill_failed = false;     // Algún archivo temporal no se pudo crear, escribir o leer
+};
+
+template <class State>
+struct SpillNode {
+    State state;
+    int g;
+    int f;
+    bool operator>(const SpillNode &other) const {
+        if (f != other.f) return f > other.f;
+        return g < other.g;
+    }
+};
+
+// Corrida ordenada por f en un archivo temporal: se escribe con append, se
+// cierra con finish y después se lee en bloques de block_nodes nodos.
+template <class State>
+class SpillRun {
+public:
+    using Node = SpillNode<State>;
+    static const size_t MIN_BLOCK = 64;
+    static const size_t MAX_BLOCK = 4096;
+
+    explicit SpillRun(size_t block_nodes) : file_(std::tmpfile()), block_(block_nodes) {
+        failed_ = file_ == nullptr;
+        // Sin búfer de stdio: se lee y escribe por bloques enteros, y así la RAM
+        // retenida por la corrida es solo su búfer de lectura.
+        if (!failed_) std::setvbuf(file_, nullptr, _IONBF, 0);
+    }
+    ~SpillRun() {
+        if (file_ != nullptr) std::fclose(file_);
+    }
+    SpillRun(const SpillRun &) = delete;
+    SpillRun &operator=(const SpillRun &) = delete;
+
+    bool append(const Node *nodes, size_t n) {
+        if (failed_) return false;
+        if (n > 0 && std::fwrite(nodes, sizeof(Node), n, file_) != n) failed_ = true;
+        else remaining_ += n;
+        return !failed_;
+    }
+
+    // Termina la escritura y carga el primer bloque.
+    bool finish() {
+        if (failed_) return false;
+        if (std::fflush(file_) != 0) failed_ = true;
+        else std::rewind(file_);
+        if (!failed_) refill();
+        return !failed_;
+    }
+
+    bool failed() const { return failed_; }
+    bool empty() const { return pos_ == buffer_.size(); }
+    const Node &head() const { return buffer_[pos_]; }
+    void pop() {
+        if (++pos_ == buffer_.size()) refill();
+    }
+
+private:
+    void refill() {
+        size_t n = std::min(block_, remaining_);
+        buffer_.resize(n);
+        pos_ = 0;
+        size_t got = n > 0 ? std::fread(buffer_.data(), sizeof(Node), n, file_) : 0;
+        if (got != n) {
+            failed_ = true; // Lectura corta: el resto de la corrida se pierde
+            remaining_ = 0;
+        } else {
+            remaining_ -= n;
+        }
+        buffer_.resize(got);
+    }
+
+    std::FILE *file_;
+    size_t block_;
+    bool failed_ = false;
+    size_t remaining_ = 0;
+    std::vector<Node> buffer_;
+    size_t pos_ = 0;
+};
+
+/**
+ * @brief A* (o BFS) con frontera acotada en RAM y volcado de segmentos fríos a disco.
+ * @param ram_budget_bytes Presupuesto de memoria para la frontera (montículo + búferes de corridas).
+ * @param use_heuristic false = orden por g (BFS por costo uniforme).
+ * @param max_nodes Límite de expansiones (la búsqueda ya no depende de la memoria).
+ */
+template <class P>
+SpillStats spill_search(const P &problem, size_t ram_budget_bytes, bool use_heuristic = true,
+                        long long max_nodes = 50000000) {
+    using State = typename P::State;
+    using Node = SpillNode<State>;
+    using Run = SpillRun<State>;
+    static_assert(std::is_trivially_copyable<State>::value, "El estado debe ser trivialmente copiable");
+
+    const size_t MIN_IN_MEMORY = 1024;
+    const size_t MAX_FAN_IN = 16;
+    // Un cuarto del presupuesto para los búferes de lectura de las corridas abiertas.
+    const size_t run_share = ram_budget_bytes / 4;
+    const size_t block_nodes = std::max(Run::MIN_BLOCK, std::min(Run::MAX_BLOCK, run_share / MAX_FAN_IN / sizeof(Node)));
+    const size_t run_bytes = block_nodes * sizeof(Node);
+    const size_t fan_in = std::max<size_t>(2, std::min(MAX_FAN_IN, run_share / run_bytes));
+
+    std::vector<Node> heap; // Montículo mínimo por f (std::greater)
+    std::vector<std::unique_ptr<Run>> runs;
+    std::vector<Run *> run_heap; // Corridas no vacías, montículo mínimo por cabeza
+    ProblemHasher<P> hasher{&problem};
+    StateTable<State, int, ProblemHasher<P>> closed(hasher);
+    SpillStats stats;
+    bool spill_disabled = false; // Tras un fallo al crear/escribir, la frontera se queda en RAM
+
+    auto h_of = [&](const State &s) { return use_heuristic ? problem.heuristic(s) : 0; };
+    auto run_after = [](const Run *a, const Run *b) { return a->head() > b->head(); };
+    auto obsolete = [&](const Node &n) { return *closed.find(n.state) < n.g; };
+
+    // Nodos que caben en el montículo una vez descontados los búferes de las corridas abiertas.
+    auto heap_limit = [&]() {
+        size_t reserved = runs.size() * run_bytes;
+        size_t free_bytes = ram_budget_bytes > reserved ? ram_budget_bytes - reserved : 0;
+        return std::max(MIN_IN_MEMORY, free_bytes / sizeof(Node));
+    };
+
+    auto rebuild_run_heap = [&]() {
+        run_heap.clear();
+        for (auto &r : runs) {
+            if (!r->empty()) run_heap.push_back(r.get());
+        }
+        std::make_heap(run_heap.begin(), run_heap.end(), run_after);
+    };
+
+    auto note_failure = [&](const Run &run) {
+        if (!run.failed()) return;
+        stats.spill_failed = true;
+        stats.truncated = true; // Puede haberse perdido parte de la corrida
+    };
+
+    // Mezcla todas las corridas abiertas en una sola (k vías), sin las entradas obsoletas.
+    auto merge_runs = [&]() {
+        std::unique_ptr<Run> merged(new Run(block_nodes));
+        std::vector<Node> block;
+        block.reserve(block_nodes);
+        while (!run_heap.empty()) {
+            std::pop_heap(run_heap.begin(), run_heap.end(), run_after);
+            Run *r = run_heap.back();
+            const Node n = r->head();
+            r->pop();
+            note_failure(*r);
+            if (r->empty()) run_heap.pop_back();
+            else std::push_heap(run_heap.begin(), run_heap.end(), run_after);
+            if (obsolete(n)) {
+                stats.dropped_on_merge++;
+                continue;
+            }
+            block.push_back(n);
+            if (block.size() == block_nodes) {
+                merged->append(block.data(), block.size());
+                block.clear();
+            }
+        }
+        merged->append(block.data(), block.size());
+        merged->finish();
+        note_failure(*merged);
+        runs.clear();
+        runs.push_back(std::move(merged));
+        stats.merges++;
+        rebuild_run_heap();
+    };
+
+    auto track_memory = [&]() {
+        stats.peak_in_memory = std::max(stats.peak_in_memory, heap.size());
+        stats.peak_resident_bytes = std::max(stats.peak_resident_bytes, heap.size() * sizeof(Node) + runs.size() * run_bytes);
+    };
+
+    auto push = [&](const Node &n) {
+        heap.push_back(n);
+        std::push_heap(heap.begin(), heap.end(), std::greater<Node>());
+        if (spill_disabled || heap.size() <= heap_limit()) return;
+        if (runs.size() >= fan_in) merge_runs();
+        // Volcar la mitad con mayor f: ordenar todo, conservar la mitad caliente en RAM.
+        std::sort(heap.begin(), heap.end(), [](const Node &a, const Node &b) { return b > a; });
+        size_t keep = heap.size() / 2;
+        std::unique_ptr<Run> run(new Run(block_nodes));
+        if (run->append(heap.data() + keep, heap.size() - keep) && run->finish()) {
+            stats.spilled_nodes += heap.size() - keep;
+            stats.runs++;
+            heap.resize(keep);
+            run_heap.push_back(run.get());
+            std::push_heap(run_heap.begin(), run_heap.end(), run_after);
+            runs.push_back(std::move(run));
+        } else {
+            // Sin disco: los nodos siguen en el montículo y no se vuelve a intentar.
+            stats.spill_failed = true;
+            spill_disabled = true;
+        }
+        std::make_heap(heap.begin(), heap.end(), std::greater<Node>());
+        track_memory();
+    };
+
+    // Extrae el menor f entre el montículo y la menor cabeza de las corridas.
+    auto pop = [&](Node &out) {
+        if (!run_heap.empty() && (heap.empty() || heap.front() > run_heap.front()->head())) {
+            std::pop_heap(run_heap.begin(), run_heap.end(), run_after);
+            Run *r = run_heap.back();
+            out = r->head();
+            r->pop();
+            note_failure(*r);
+            if (!r->empty()) {
+                std::push_heap(run_heap.begin(), run_heap.end(), run_after);
+            } else {
+                // Corrida agotada: se cierra y deja de contar en el presupuesto.
+                run_heap.pop_back();
+                runs.erase(std::find_if(runs.begin(), runs.end(), [&](const std::unique_ptr<Run> &p) { return p.get() == r; }));
+            }
+            return true;
+        }
+        if (heap.empty()) return false;
+        std::pop_heap(heap.begin(), heap.end(), std::greater<Node>());
+        out = heap.back();
+        heap.pop_back();
+        return true;
+    };
+
+    State start = problem.initial();
+    int h0 = h_of(start);
+    if (h0 >= SEARCH_INF) return stats;
+    closed.insert(start, 0);
+    push({start, 0, h0});
+
+    Node cur;
+    while (pop(cur)) {
+        track_memory();
+        if (obsolete(cur)) continue; // Entrada obsoleta (también las de disco)
+        stats.expanded++;
+        SEARCH_TRACE(TRACE_EXPAND, hasher(cur.state), cur.g, cur.g, cur.f - cur.g);
+        if (problem.is_goal(cur.state)) {
+            SEARCH_TRACE(TRACE_GOAL, hasher(cur.state), cur.g, cur.g, 0);
+            stats.found = true;
+            stats.cost = cur.g;
+            break;
+        }
+        if (stats.expanded > max_nodes) {
+            stats.truncated = true;
+            break;
+        }
+        problem.expand(cur.state, [&](const State &next, int step_cost) {
+            stats.generated++;
+            int g = cur.g + step_cost;
+            auto ins = closed.insert(next, g);
+            if (!ins.second) {
+                if (*ins.first <= g) {
+                    SEARCH_TRACE(TRACE_PRUNE, hasher(next), g, g, -1);
+                    return;
+                }
+                *ins.first = g;
+            }
+            int h = h_of(next);
+            if (h >= SEARCH_INF) {
+                SEARCH_TRACE(TRACE_PRUNE, hasher(next), g, g, -1);
+                return;
+            }
+            SEARCH_TRACE(TRACE_GENERATE, hasher(next), g, g, h);
+            push({next, g, g + h});
+        });
+    }
+    return stats;
+}
+
+#endif // SPILL_SEARCH_H
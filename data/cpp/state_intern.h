@@ -0,0 +1,182 @@
+// --- Internado de estados compartido entre algoritmos de una misma ejecución ---
+//
+// Cada estado distinto se guarda una sola vez en un vector contiguo y se
+// identifica por su índice (uint32_t). El índice hash guarda solo ids, no
+// copias del estado, así que el costo por estado es sizeof(State) más unos
+// pocos bytes de tabla.
+//
+// InternedProblem<P> expone la interfaz de search_core.h con State = id y
+// memoriza la lista de sucesores de cada estado la primera vez que alguien lo
+// expande: los motores que compartan el mismo objeto (A*, BFS, ...) reutilizan
+// estados, heurísticas y sucesores en lugar de recalcularlos.
+//
+// No es seguro entre hilos: se comparte entre motores secuenciales (p. ej. los
+// de stepper.h en el modo lockstep), no con HDA* ni con el BFS paralelo.
+//
+// Por qué solo el modo lockstep (SEARCH_LOCKSTEP) lo usa. En la ruta por
+// defecto no hay dos motores secuenciales del núcleo con conjunto exacto de
+// visitados que puedan compartirlo:
+//   - HDA* y el BFS paralelo son multihilo; cada hilo es dueño de su partición.
+//   - El A* con volcado a disco existe para acotar la RAM; un almacén en
+//     memoria con todos los estados anula ese límite.
+//   - El BFS aproximado (Bloom) y Beam Search no guardan los estados a
+//     propósito, e IDA* solo tiene su tabla de transposición de tamaño fijo.
+//   - El BFS bidireccional (solo Hanói) es el único que queda: no tendría con
+//     quién compartir.
+//   - Los bucles heredados (run_bfs / run_a_star) usan vectores y std::set, no
+//     el estado empaquetado del núcleo.
+// Además, la tabla compara tiempos de cada algoritmo por separado: si el
+// segundo motor reutilizara los sucesores memorizados por el primero, su tiempo
+// ya no mediría su propia búsqueda. En lockstep los motores avanzan a la vez con
+// el mismo presupuesto, así que ahí compartir es justamente lo que se mide.
+
+#ifndef STATE_INTERN_H
+#define STATE_INTERN_H
+
+#include "search_core.h"
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+/**
+ * @brief Almacén hash-consed: intern(s) devuelve el mismo id para estados iguales.
+ */
+template <class State, class Hasher>
+class StateInterner {
+public:
+    using Id = uint32_t;
+    static constexpr Id NONE = 0xffffffffu;
+
+    explicit StateInterner(Hasher hasher) : hasher_(hasher), slots_(1024, NONE) {}
+
+    Id intern(const State &s) {
+        if ((states_.size() + 1) * 10 > slots_.size() * 7) grow();
+        size_t mask = slots_.size() - 1;
+        size_t i = hasher_(s) & mask;
+        for (; slots_[i] != NONE; i = (i + 1) & mask) {
+            if (states_[slots_[i]] == s) return slots_[i];
+        }
+        slots_[i] = (Id)states_.size();
+        states_.push_back(s);
+        return slots_[i];
+    }
+
+    const State &get(Id id) const { return states_[id]; }
+    size_t size() const { return states_.size(); }
+    size_t bytes() const { return states_.capacity() * sizeof(State) + slots_.size() * sizeof(Id); }
+
+private:
+    void grow() {
+        slots_.assign(slots_.size() * 2, NONE);
+        size_t mask = slots_.size() - 1;
+        for (Id id = 0; id < (Id)states_.size(); ++id) {
+            size_t i = hasher_(states_[id]) & mask;
+            while (slots_[i] != NONE) i = (i + 1) & mask;
+            slots_[i] = id;
+        }
+    }
+
+    Hasher hasher_;
+    std::vector<State> states_;  // Estados únicos, inmutables una vez internados
+    std::vector<Id> slots_;      // Direccionamiento abierto sobre ids
+};
+
+// Reutilización de la memoria compartida.
+struct InternStats {
+    size_t states = 0;           // Estados distintos internados
+    size_t bytes = 0;            // Almacén + índice + sucesores memorizados
+    long long expansions = 0;    // Llamadas a expand de todos los motores
+    long long memo_hits = 0;     // ... servidas desde la lista memorizada
+};
+
+/**
+ * @brief Problema del núcleo sobre ids internados, con heurística y sucesores memorizados.
+ */
+template <class P>
+class InternedProblem {
+public:
+    using State = uint32_t;
+    using Inner = typename P::State;
+
+    explicit InternedProblem(const P &problem) : problem_(problem), store_(ProblemHasher<P>{&problem}) {
+        initial_ = intern(problem.initial());
+    }
+    InternedProblem(const InternedProblem &) = delete;
+    InternedProblem &operator=(const InternedProblem &) = delete;
+
+    State initial() const { return initial_; }
+    bool is_goal(State id) const { return problem_.is_goal(store_.get(id)); }
+    uint64_t hash(State id) const { return id; }
+
+    int heuristic(State id) const {
+        if (heuristic_[id] == UNKNOWN) heuristic_[id] = problem_.heuristic(store_.get(id));
+        return heuristic_[id];
+    }
+
+    template <class Visit>
+    void expand(State id, Visit &&visit) const {
+        stats_.expansions++;
+        if (first_edge_[id] == UNKNOWN) {
+            // Primera expansión de este estado: generar, internar y memorizar los sucesores.
+            // Se expande una copia: internar sucesores puede reubicar el almacén.
+            Inner current = store_.get(id);
+            first_edge_[id] = (int64_t)edges_.size();
+            problem_.expand(current, [&](const Inner &next, int cost) { edges_.push_back({intern(next), cost}); });
+            edge_count_[id] = (uint32_t)(edges_.size() - first_edge_[id]);
+        } else {
+            stats_.memo_hits++;
+        }
+        for (uint32_t k = 0; k < edge_count_[id]; ++k) {
+            Edge e = edges_[first_edge_[id] + k];
+            visit(e.to, e.cost);
+        }
+    }
+
+    // Estado original detrás de un id (para mostrar o verificar soluciones).
+    const Inner &state(State id) const { return store_.get(id); }
+
+    InternStats stats() const {
+        InternStats s = stats_;
+        s.states = store_.size();
+        s.bytes = store_.bytes() + edges_.capacity() * sizeof(Edge) +
+                  first_edge_.capacity() * (sizeof(int64_t) + sizeof(uint32_t) + sizeof(int));
+        return s;
+    }
+
+private:
+    struct Edge {
+        State to;
+        int cost;
+    };
+    static constexpr int UNKNOWN = -1;
+
+    State intern(const Inner &s) const {
+        State id = store_.intern(s);
+        if (id == first_edge_.size()) {
+            first_edge_.push_back(UNKNOWN);
+            edge_count_.push_back(0);
+            heuristic_.push_back(UNKNOWN);
+        }
+        return id;
+    }
+
+    const P &problem_;
+    mutable StateInterner<Inner, ProblemHasher<P>> store_;
+    mutable std::vector<Edge> edges_;          // Sucesores memorizados, contiguos por estado
+    mutable std::vector<int64_t> first_edge_;  // Primer sucesor de cada id (UNKNOWN = sin expandir)
+    mutable std::vector<uint32_t> edge_count_;
+    mutable std::vector<int> heuristic_;       // h memorizada (UNKNOWN = sin calcular)
+    mutable InternStats stats_;
+    State initial_;
+};
+
+/**
+ * @brief Línea de resumen del almacén compartido (estados, memoria y sucesores reutilizados).
+ */
+inline void print_intern_stats(const InternStats &stats, std::ostream &out = std::cout) {
+    out << "   * Estados internados: " << stats.states << " (" << stats.bytes / 1024 << " KB), sucesores reutilizados "
+        << stats.memo_hits << " de " << stats.expansions << " expansiones" << std::endl;
+}
+
+#endif // STATE_INTERN_H
@@ -0,0 +1,421 @@
+// --- Motores por pasos y planificador en paralelo "lockstep" ---
+//
+// Comparar algoritmos con ejecuciones secuenciales de reloj de pared depende
+// del orden y de cuánto estaba caliente la caché. Aquí cada motor es una
+// máquina de estados explícita (sin corrutinas: el proyecto compila con
+// C++17) que conserva su frontera entre llamadas:
+//
+//   StepStatus step(long long k);   // avanza hasta k unidades de trabajo
+//   long long work() const;         // trabajo acumulado (expansiones / iteraciones)
+//
+// El planificador da a cada motor el mismo cuanto por ronda en un solo hilo,
+// así que todos se comparan con el mismo presupuesto de trabajo. Pausar es
+// dejar de llamar a step() y abortar es descartar el objeto: no cuesta nada.
+//
+// Motores: A* y BFS sobre la interfaz de search_core.h, IDA* sobre la de
+// ida_star.h, el recocido simulado (SaStepper, en simulated_annealing.h), la
+// búsqueda tabú (TabuStepper, en tabu_search.h) y beam search (BeamStepper, en
+// beam_search.h). La unidad de trabajo es una expansión en los motores de
+// árbol/grafo y una iteración en los de búsqueda local. Se activa en las
+// simulaciones con SEARCH_LOCKSTEP=<cuanto>, p. ej. 256.
+//
+// Quedan fuera, a propósito:
+//   - HDA* (hda_star.h) y el BFS paralelo (parallel_bfs.h): reparten el trabajo
+//     entre varios hilos, así que un cuanto en un solo hilo no mide lo mismo y
+//     pausarlos obligaría a detener y reanudar todo el grupo de hilos.
+//   - A* externo (spill_search.h): su costo lo dominan las escrituras y
+//     lecturas de las corridas en disco, no las expansiones.
+//   - BFS bidireccional (bidirectional_search.h) y BFS aproximado
+//     (approx_visited.h): son BFS con otra frontera u otro conjunto de
+//     visitados; en lockstep los representa BfsStepper.
+//   - Los bucles originales de cada archivo (backtracking, BFS, A* y Hill
+//     Climbing sobre vector<int>): no usan la interfaz de search_core.h y se
+//     conservan tal cual como línea base de la ejecución normal; sus
+//     equivalentes por pasos son AStarStepper y BfsStepper sobre el mismo problema.
+//   - Los motores propios de N-Reinas (bitboard, plantillas, conteo paralelo,
+//     DLX, min-conflicts, constructivo): recursiones, hilos o fórmulas que
+//     resuelven en microsegundos o en O(N). El BFS/A* en árbol de
+//     nqueens_tree.h guarda la frontera como arena de bytes y se mide en la
+//     ejecución normal; en lockstep lo cubren AStarStepper y BfsStepper.
+
+#ifndef STEPPER_H
+#define STEPPER_H
+
+#include "search_core.h"
+#include "ida_star.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <queue>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+template <class State>
+struct StepNode {
+    State state;
+    int g;
+    int f;
+    bool operator>(const StepNode &other) const {
+        if (f != other.f) return f > other.f;
+        return g < other.g;
+    }
+};
+
+/**
+ * @brief A* reanudable: la lista abierta y la cerrada sobreviven entre llamadas a step().
+ */
+template <class P>
+class AStarStepper {
+public:
+    using State = typename P::State;
+    using Node = StepNode<State>;
+
+    explicit AStarStepper(const P &problem) : problem_(problem), hasher_{&problem}, closed_(hasher_) {
+        State start = problem_.initial();
+        int h = problem_.heuristic(start);
+        if (h >= SEARCH_INF) return;
+        closed_.insert(start, 0);
+        open_.push({start, 0, h});
+    }
+
+    StepStatus step(long long budget) {
+        while (budget > 0 && status_ == STEP_RUNNING) {
+            if (open_.empty()) {
+                status_ = STEP_EXHAUSTED;
+                break;
+            }
+            Node cur = open_.top();
+            open_.pop();
+            if (*closed_.find(cur.state) < cur.g) continue; // Entrada obsoleta: no gasta presupuesto
+            budget--;
+            stats_.expanded++;
+            SEARCH_TRACE(TRACE_EXPAND, hasher_(cur.state), cur.g, cur.g, cur.f - cur.g);
+            if (problem_.is_goal(cur.state)) {
+                SEARCH_TRACE(TRACE_GOAL, hasher_(cur.state), cur.g, cur.g, 0);
+                stats_.found = true;
+                stats_.cost = cur.g;
+                status_ = STEP_FOUND;
+                break;
+            }
+            problem_.expand(cur.state, [&](const State &next, int step_cost) {
+                stats_.generated++;
+                int g = cur.g + step_cost;
+                auto ins = closed_.insert(next, g);
+                if (!ins.second) {
+                    if (*ins.first <= g) return;
+                    *ins.first = g;
+                }
+                int h = problem_.heuristic(next);
+                if (h >= SEARCH_INF) return;
+                SEARCH_TRACE(TRACE_GENERATE, hasher_(next), g, g, h);
+                open_.push({next, g, g + h});
+            });
+        }
+        return status_;
+    }
+
+    long long work() const { return stats_.expanded; }
+    const SearchStats &stats() const { return stats_; }
+
+private:
+    const P &problem_;
+    ProblemHasher<P> hasher_;
+    StateTable<State, int, ProblemHasher<P>> closed_;  // Mejor g conocido
+    std::priority_queue<Node, std::vector<Node>, std::greater<Node>> open_;
+    SearchStats stats_;
+    StepStatus status_ = STEP_RUNNING;
+};
+
+/**
+ * @brief BFS reanudable (cola FIFO + visitados); cost es la profundidad de la solución.
+ */
+template <class P>
+class BfsStepper {
+public:
+    using State = typename P::State;
+
+    explicit BfsStepper(const P &problem) : problem_(problem), hasher_{&problem}, visited_(hasher_) {
+        State start = problem_.initial();
+        visited_.insert(start, 0);
+        queue_.push_back(start);
+    }
+
+    StepStatus step(long long budget) {
+        for (; budget > 0 && status_ == STEP_RUNNING; --budget) {
+            if (queue_.empty()) {
+                status_ = STEP_EXHAUSTED;
+                break;
+            }
+            State cur = queue_.front();
+            queue_.pop_front();
+            int depth = *visited_.find(cur);
+            stats_.expanded++;
+            SEARCH_TRACE(TRACE_EXPAND, hasher_(cur), depth, depth, -1);
+            if (problem_.is_goal(cur)) {
+                SEARCH_TRACE(TRACE_GOAL, hasher_(cur), depth, depth, 0);
+                stats_.found = true;
+                stats_.cost = depth;
+                status_ = STEP_FOUND;
+                break;
+            }
+            problem_.expand(cur, [&](const State &next, int) {
+                stats_.generated++;
+                if (!visited_.insert(next, depth + 1).second) return;
+                SEARCH_TRACE(TRACE_GENERATE, hasher_(next), depth + 1, depth + 1, -1);
+                queue_.push_back(next);
+            });
+        }
+        return status_;
+    }
+
+    long long work() const { return stats_.expanded; }
+    const SearchStats &stats() const { return stats_; }
+
+private:
+    const P &problem_;
+    ProblemHasher<P> hasher_;
+    StateTable<State, int, ProblemHasher<P>> visited_;  // Profundidad de cada estado
+    std::deque<State> queue_;
+    SearchStats stats_;
+    StepStatus status_ = STEP_RUNNING;
+};
+
+/**
+ * @brief IDA* reanudable: la recursión de ida_star.h pasa a una pila explícita de marcos.
+ *
+ * Sin tabla de transposición (memoria O(profundidad)); conserva la poda del padre.
+ */
+template <class P>
+class IdaStarStepper {
+public:
+    using State = typename P::State;
+    using Move = typename P::Move;
+
+    explicit IdaStarStepper(const P &problem) : problem_(problem), hasher_{&problem} {}
+
+    StepStatus step(long long budget) {
+        while (budget > 0 && status_ == STEP_RUNNING) {
+            if (frames_.empty()) {
+                start_iteration(budget);
+                continue;
+            }
+            size_t depth = frames_.size() - 1;
+            Frame &top = frames_[depth];
+            if (top.next == top.count) {
+                // Subárbol agotado: devolver su menor f excedido al padre.
+                int exceeded = top.min_exceeded;
+                Move via = top.via;
+                frames_.pop_back();
+                if (frames_.empty()) {
+                    next_threshold_ = exceeded;
+                } else {
+                    problem_.undo(state_, via);
+                    frames_.back().min_exceeded = std::min(frames_.back().min_exceeded, exceeded);
+                    SEARCH_TRACE(TRACE_BACKTRACK, hasher_(state_), depth - 1, frames_.back().g, -1);
+                }
+                continue;
+            }
+            Move m = moves_[depth * P::MAX_MOVES + top.next++];
+            int g = top.g + 1;
+            problem_.apply(state_, m);
+            stats_.generated++;
+            SEARCH_TRACE(TRACE_GENERATE, hasher_(state_), depth + 1, g, -1);
+            if (depth > 0 && state_ == path_[depth - 1]) { // Poda del padre
+                problem_.undo(state_, m);
+                continue;
+            }
+            int exceeded = enter(g, m, budget);
+            if (status_ == STEP_FOUND) break;
+            if (exceeded >= 0) {
+                frames_[depth].min_exceeded = std::min(frames_[depth].min_exceeded, exceeded);
+                problem_.undo(state_, m);
+            }
+        }
+        return status_;
+    }
+
+    long long work() const { return stats_.expanded; }
+    const IdaStats &stats() const { return stats_; }
+
+private:
+    struct Frame {
+        int g;
+        int count;          // Movimientos generados en este nivel
+        int next = 0;       // Siguiente movimiento a probar
+        int min_exceeded = SEARCH_INF;
+        Move via;           // Movimiento que llevó del padre a este nodo
+    };
+
+    void start_iteration(long long &budget) {
+        if (threshold_ >= 0) {
+            stats_.nodes_per_iteration.push_back(stats_.expanded - iteration_start_);
+            if (next_threshold_ >= SEARCH_INF) {
+                status_ = STEP_EXHAUSTED;
+                return;
+            }
+            threshold_ = next_threshold_;
+        } else {
+            state_ = problem_.initial();
+            threshold_ = problem_.heuristic(state_);
+        }
+        stats_.iterations++;
+        iteration_start_ = stats_.expanded;
+        next_threshold_ = SEARCH_INF;
+        int exceeded = enter(0, Move(), budget);
+        if (exceeded >= 0) next_threshold_ = exceeded;
+    }
+
+    // Evalúa el nodo actual: f excedido (>= 0) si se poda, -1 si se apila su marco.
+    int enter(int g, const Move &via, long long &budget) {
+        size_t depth = frames_.size();
+        int h = problem_.heuristic(state_);
+        if (h >= SEARCH_INF) return SEARCH_INF;
+        if (g + h > threshold_) {
+            SEARCH_TRACE(TRACE_PRUNE, hasher_(state_), depth, g, h);
+            return g + h;
+        }
+        budget--;
+        stats_.expanded++;
+        SEARCH_TRACE(TRACE_EXPAND, hasher_(state_), depth, g, h);
+        if (problem_.is_goal(state_)) {
+            SEARCH_TRACE(TRACE_GOAL, hasher_(state_), depth, g, 0);
+            stats_.found = true;
+            stats_.cost = g;
+            stats_.nodes_per_iteration.push_back(stats_.expanded - iteration_start_);
+            status_ = STEP_FOUND;
+            return -1;
+        }
+        if ((depth + 1) * P::MAX_MOVES > moves_.size()) moves_.resize((depth + 1) * P::MAX_MOVES * 2);
+        if (depth + 1 > path_.size()) path_.resize(depth + 1);
+        path_[depth] = state_;
+        Frame frame;
+        frame.g = g;
+        frame.count = problem_.moves(state_, &moves_[depth * P::MAX_MOVES]);
+        frame.via = via;
+        frames_.push_back(frame);
+        return -1;
+    }
+
+    const P &problem_;
+    ProblemHasher<P> hasher_;
+    State state_{};
+    std::vector<Frame> frames_;
+    std::vector<Move> moves_;
+    std::vector<State> path_;
+    int threshold_ = -1;             // -1 = aún no empezó la primera iteración
+    int next_threshold_ = SEARCH_INF;
+    long long iteration_start_ = 0;
+    IdaStats stats_;
+    StepStatus status_ = STEP_RUNNING;
+};
+
+// --- Planificador lockstep ---
+
+struct LockstepEntry {
+    std::string name;
+    std::function<StepStatus(long long)> step;   // Avanza hasta k unidades de trabajo
+    std::function<long long()> work;             // Trabajo acumulado
+};
+
+/**
+ * @brief Envuelve cualquier motor por pasos (el planificador comparte su propiedad).
+ */
+template <class S>
+LockstepEntry make_lockstep_entry(const std::string &name, std::shared_ptr<S> stepper) {
+    return {name, [stepper](long long k) { return stepper->step(k); }, [stepper] { return stepper->work(); }};
+}
+
+struct LockstepReport {
+    std::string name;
+    StepStatus status = STEP_RUNNING;  // STEP_RUNNING al final = se quedó sin presupuesto
+    long long work = 0;
+    int turns = 0;                     // Cuantos recibidos
+    double cpu_ms = 0;                 // Tiempo dentro de sus propios step()
+};
+
+struct LockstepResult {
+    int winner = -1;      // Resuelto con menos trabajo (-1 = ninguno)
+    int rounds = 0;
+    long long quantum = 0;
+    std::vector<LockstepReport> reports;
+};
+
+// Cuanto pedido con SEARCH_LOCKSTEP=<k> (0 = modo desactivado).
+inline long long lockstep_quantum() {
+    const char *quantum = std::getenv("SEARCH_LOCKSTEP");
+    return quantum != nullptr ? std::max(0LL, std::atoll(quantum)) : 0;
+}
+
+/**
+ * @brief Intercala los motores en un hilo, un cuanto por ronda, hasta que alguno resuelve.
+ *
+ * La ronda en la que aparece la primera solución se completa, de modo que
+ * todos reciben el mismo número de cuantos antes de decidir el ganador.
+ * @param budget Trabajo máximo por motor.
+ */
+inline LockstepResult run_lockstep(const std::vector<LockstepEntry> &entries, long long quantum,
+                                   long long budget) {
+    using Clock = std::chrono::high_resolution_clock;
+    LockstepResult result;
+    result.quantum = quantum = std::max(1LL, quantum);
+    result.reports.resize(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) result.reports[i].name = entries[i].name;
+
+    bool solved = false;
+    bool progressed = true;
+    while (!solved && progressed) {
+        progressed = false;
+        result.rounds++;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            LockstepReport &r = result.reports[i];
+            long long allowance = std::min(quantum, budget - r.work);
+            if (r.status != STEP_RUNNING || allowance <= 0) continue;
+            auto t0 = Clock::now();
+            r.status = entries[i].step(allowance);
+            r.cpu_ms += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count() / 1e6;
+            r.work = entries[i].work();
+            r.turns++;
+            progressed = true;
+            if (r.status == STEP_FOUND) solved = true;
+        }
+    }
+
+    for (size_t i = 0; i < result.reports.size(); ++i) {
+        const LockstepReport &r = result.reports[i];
+        if (r.status != STEP_FOUND) continue;
+        if (result.winner < 0 || r.work < result.reports[result.winner].work ||
+            (r.work == result.reports[result.winner].work && r.cpu_ms < result.reports[result.winner].cpu_ms))
+            result.winner = (int)i;
+    }
+    return result;
+}
+
+/**
+ * @brief Tabla lockstep (trabajo, cuantos y CPU de cada motor) y línea "> Algoritmo:" del ganador.
+ */
+inline void print_lockstep(const LockstepResult &result, std::ostream &out = std::cout) {
+    out << std::fixed << std::setprecision(4) << "\n--- Lockstep: cuanto de " << result.quantum
+        << " por ronda, " << result.rounds << " rondas en un hilo ---" << std::endl;
+    for (const LockstepReport &r : result.reports) {
+        const char *state = r.status == STEP_FOUND ? "Resuelto " : (r.status == STEP_EXHAUSTED ? "Agotado  " : "Pausado  ");
+        out << "| " << std::setw(42) << std::left << r.name << " | trabajo " << std::setw(10) << std::right << r.work
+            << " | cuantos " << std::setw(6) << r.turns << " | " << std::setw(11) << r.cpu_ms << " ms | " << state << " |"
+            << std::endl;
+    }
+    if (result.winner >= 0) {
+        const LockstepReport &w = result.reports[result.winner];
+        out << "\n🏆 MENOR TRABAJO HASTA LA SOLUCIÓN (" << w.work << " unidades):" << std::endl;
+        out << "   > Algoritmo: " << w.name << std::endl;
+        out << "   > Tiempo: " << w.cpu_ms << " ms" << std::endl;
+    } else {
+        out << "\n   > Algoritmo: Ninguno (Fallo)" << std::endl;
+    }
+}
+
+#endif // STEPPER_H
@@ -0,0 +1,191 @@
+// --- Búsqueda tabú genérica con aspiración y evaluación incremental ---
+//
+// Para problemas de asignación variable -> valor (reinas por fila, colores por
+// vértice). El problema mantiene una tabla de evaluación incremental: delta()
+// responde en O(1) cuánto cambia el costo al reasignar una variable, y
+// assign() actualiza solo lo que toca la variable movida (sus vecinos). Así
+// cada iteración cuesta O(variables candidatas * valores) y no se copia nunca
+// la asignación completa (duck typing, sin herencia):
+//
+//   struct MiProblemaTabu {
+//       long long cost() const;                  // costo actual (0 = solución)
+//       int variables() const;                   // número de variables
+//       int values() const;                      // tamaño del dominio: valores 0..values()-1
+//       int value(int var) const;                // valor actual de var
+//       int conflicted_count() const;            // variables en conflicto (conjunto indexado)
+//       int conflicted(int i) const;             // i-ésima variable en conflicto
+//       long long delta(int var, int val) const; // cambio de costo si var = val, en O(1)
+//       void assign(int var, int val);           // aplica y actualiza la tabla en O(vecinos)
+//   };
+//
+// En cada iteración se elige el mejor movimiento no tabú de las variables en
+// conflicto (todas o una muestra). Tras mover var desde el valor v, volver a
+// v queda prohibido durante `tenure` iteraciones, salvo que mejore el mejor
+// costo conocido (criterio de aspiración).
+
+#ifndef TABU_SEARCH_H
+#define TABU_SEARCH_H
+
+#include "anytime_profile.h"
+#include "search_core.h"
+#include "simulated_annealing.h"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <algorithm>
+
+// Duración tabú: base + aleatorio en [0, random_span] + factor * variables en conflicto.
+struct TabuTenure {
+    int base = 10;
+    int random_span = 10;
+    double conflict_factor = 0.6;  // Tenencia reactiva: crece cuando hay muchos conflictos
+
+    int draw(SaRng &rng, int conflicted) const {
+        return base + (random_span > 0 ? rng.below(random_span + 1) : 0) + (int)(conflict_factor * conflicted);
+    }
+};
+
+struct TabuOptions {
+    long long max_iterations = 1000000;
+    long long target_cost = 0;        // Parar al alcanzar este costo
+    TabuTenure tenure;
+    int sampled_variables = 0;        // Variables en conflicto evaluadas por iteración (0 = todas)
+    size_t tabu_slots = 1 << 20;      // Si variables * valores no cabe, la lista tabú se indexa por hash
+    uint64_t seed = 1;
+    const std::atomic<bool> *stop = nullptr; // Cancelación externa, cada 1024 iteraciones
+};
+
+struct TabuStats {
+    bool found = false;          // ¿Se alcanzó target_cost?
+    long long best_cost = 0;
+    long long final_cost = 0;
+    long long iterations = 0;
+    long long evaluated = 0;     // Movimientos evaluados con delta()
+    long long aspirations = 0;   // Movimientos tabú aceptados por mejorar el mejor costo
+    long long blocked = 0;       // Iteraciones sin movimiento permitido (se fuerza uno aleatorio)
+};
+
+/**
+ * @brief Búsqueda tabú reanudable: cada unidad de trabajo es una iteración (stepper.h).
+ */
+template <class P>
+class TabuStepper {
+public:
+    TabuStepper(P &problem, const TabuOptions &options, AnytimeProfile *profile = nullptr)
+        : problem_(problem), options_(options), profile_(profile), rng_(options.seed),
+          values_(problem.values()), cost_(problem.cost()) {
+        // tabu_until_[slot(var, val)] = primera iteración en la que var = val vuelve a estar permitido.
+        const uint64_t pairs = (uint64_t)problem.variables() * values_;
+        exact_ = pairs <= options_.tabu_slots;
+        tabu_until_.assign(exact_ ? (size_t)pairs : options_.tabu_slots, 0);
+        stats_.best_cost = stats_.final_cost = cost_;
+        stats_.found = cost_ <= options_.target_cost;
+        if (profile_ != nullptr) profile_->record(cost_);
+    }
+
+    StepStatus step(long long budget) {
+        for (; budget > 0 && status() == STEP_RUNNING; --budget) {
+            stats_.iterations++;
+            int count = problem_.conflicted_count();
+            if (count == 0) { // Costo > 0 sin variables en conflicto: el problema no se puede mejorar así
+                stuck_ = true;
+                break;
+            }
+            iterate(count);
+        }
+        stats_.final_cost = cost_;
+        stats_.found = stats_.best_cost <= options_.target_cost;
+        return status();
+    }
+
+    StepStatus status() const {
+        if (cost_ <= options_.target_cost) return STEP_FOUND;
+        if (stuck_ || values_ <= 1) return STEP_EXHAUSTED;
+        return stats_.iterations < options_.max_iterations ? STEP_RUNNING : STEP_EXHAUSTED;
+    }
+    long long work() const { return stats_.iterations; }
+    const TabuStats &stats() const { return stats_; }
+
+private:
+    size_t slot(int var, int val) const {
+        uint64_t key = (uint64_t)var * values_ + val;
+        return (size_t)(exact_ ? key : mix_hash(key) % tabu_until_.size());
+    }
+
+    void iterate(int count) {
+        int scan = options_.sampled_variables > 0 ? std::min(count, options_.sampled_variables) : count;
+        long long best_delta = std::numeric_limits<long long>::max();
+        int best_var = -1, best_val = -1, ties = 0;
+        bool best_is_aspiration = false;
+        for (int k = 0; k < scan; ++k) {
+            int var = problem_.conflicted(scan == count ? k : rng_.below(count));
+            int current = problem_.value(var);
+            for (int val = 0; val < values_; ++val) {
+                if (val == current) continue;
+                long long d = problem_.delta(var, val);
+                stats_.evaluated++;
+                bool tabu = tabu_until_[slot(var, val)] > stats_.iterations;
+                if (tabu && cost_ + d >= stats_.best_cost) continue; // Tabú y sin aspiración
+                if (d < best_delta) {
+                    best_delta = d;
+                    best_var = var;
+                    best_val = val;
+                    best_is_aspiration = tabu;
+                    ties = 1;
+                } else if (d == best_delta && rng_.below(++ties) == 0) { // Empates: elección uniforme
+                    best_var = var;
+                    best_val = val;
+                    best_is_aspiration = tabu;
+                }
+            }
+        }
+        if (best_var < 0) {
+            // Todo es tabú: movimiento aleatorio para no quedarse quieto.
+            stats_.blocked++;
+            best_var = problem_.conflicted(rng_.below(count));
+            best_val = rng_.below(values_ - 1);
+            if (best_val >= problem_.value(best_var)) best_val++;
+            best_delta = problem_.delta(best_var, best_val);
+        }
+        if (best_is_aspiration) stats_.aspirations++;
+
+        int previous = problem_.value(best_var);
+        problem_.assign(best_var, best_val);
+        cost_ += best_delta;
+        tabu_until_[slot(best_var, previous)] = stats_.iterations + options_.tenure.draw(rng_, problem_.conflicted_count());
+        if (cost_ < stats_.best_cost) {
+            stats_.best_cost = cost_;
+            if (profile_ != nullptr) profile_->record(cost_);
+        }
+    }
+
+    P &problem_;
+    TabuOptions options_;
+    AnytimeProfile *profile_;
+    SaRng rng_;
+    int values_;
+    long long cost_;
+    bool exact_ = true;
+    bool stuck_ = false;
+    std::vector<long long> tabu_until_;
+    TabuStats stats_;
+};
+
+/**
+ * @brief Búsqueda tabú sobre un problema con tabla de evaluación incremental.
+ * @param problem Estado mutable del problema (queda en el último estado visitado).
+ * @param profile Curva opcional mejor-costo vs. tiempo.
+ */
+template <class P>
+TabuStats tabu_search(P &problem, const TabuOptions &options, AnytimeProfile *profile = nullptr) {
+    TabuStepper<P> stepper(problem, options, profile);
+    // Bloques de 1024 iteraciones: entre bloque y bloque se consulta la cancelación externa.
+    while (stepper.step(1024) == STEP_RUNNING) {
+        if (options.stop != nullptr && options.stop->load(std::memory_order_relaxed)) break;
+    }
+    return stepper.stats();
+}
+
+#endif // TABU_SEARCH_H
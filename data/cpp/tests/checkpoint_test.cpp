@@ -0,0 +1,95 @@
+// --- Prueba de la huella de los checkpoints (ver checkpoint.h y parallel_bfs.h) ---
+//
+// Uso:
+//   g++ -O2 -std=c++17 -pthread checkpoint_test.cpp -o checkpoint_test && ./checkpoint_test
+//
+// Corta un BFS paralelo de Hanói 3x6 por el límite de estados (el checkpoint se
+// conserva) y comprueba que:
+//   - la misma instancia reanuda desde el nivel guardado;
+//   - otra instancia de la familia (más discos, más postes) no lo acepta, aunque
+//     todas empiezan en el estado 0;
+//   - el mismo archivo leído con la etiqueta de otro motor tampoco.
+// Para el conteo paralelo de N-Reinas (nqueens_parallel.h) escribe a mano un
+// checkpoint con todas las tareas terminadas: el mismo N lo toma tal cual y
+// otro N lo ignora y cuenta desde cero.
+// Devuelve 0 si todo pasa.
+
+#include <cstdio>
+#include <string>
+
+#include "../hanoi_problem.h"
+#include "../parallel_bfs.h"
+#include "../nqueens_parallel.h"
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+    if (ok) return;
+    failures++;
+    std::printf("FALLO %s\n", what);
+}
+
+int main() {
+    const std::string path = "checkpoint_test.sckp";
+    CheckpointConfig config;
+    config.path = path.c_str();
+    config.interval_seconds = 0.0;
+
+    HanoiProblem small(3, 6);
+    std::remove(config.path);
+    ParallelBfsStats cut = parallel_bfs(small, 1, 100, config);
+    check(cut.truncated && cut.checkpoints > 0, "el corte por límite escribe un checkpoint");
+
+    HanoiProblem more_disks(3, 7), more_pegs(4, 6);
+    check(small.fingerprint() != more_disks.fingerprint(), "huellas distintas con otro número de discos");
+    check(small.fingerprint() != more_pegs.fingerprint(), "huellas distintas con otro número de postes");
+
+    {
+        CheckpointReader reader(config.path, sizeof(HanoiProblem::State),
+                                checkpoint_fingerprint(more_disks, "parallel_bfs"));
+        check(!reader.ok(), "rechaza el checkpoint de otra instancia (discos)");
+    }
+    {
+        CheckpointReader reader(config.path, sizeof(HanoiProblem::State),
+                                checkpoint_fingerprint(more_pegs, "parallel_bfs"));
+        check(!reader.ok(), "rechaza el checkpoint de otra instancia (postes)");
+    }
+    {
+        CheckpointReader reader(config.path, sizeof(HanoiProblem::State), checkpoint_fingerprint(small, "spill_a_star"));
+        check(!reader.ok(), "rechaza el checkpoint de otro motor");
+    }
+
+    // parallel_bfs con otra instancia empieza de cero (y, al terminar, borra el archivo).
+    ParallelBfsStats other = parallel_bfs(more_disks, 1, 5000000, config);
+    check(other.resumed_level == -1, "otra instancia no reanuda");
+    check(other.found && other.cost == 127, "otra instancia resuelve desde el inicio");
+
+    // La misma instancia sí reanuda.
+    std::remove(config.path);
+    parallel_bfs(small, 1, 100, config);
+    ParallelBfsStats resumed = parallel_bfs(small, 1, 5000000, config);
+    check(resumed.resumed_level == cut.levels, "la misma instancia reanuda desde el nivel guardado");
+    check(resumed.found && resumed.cost == 63, "la reanudación llega al óptimo");
+
+    // Conteo de N-Reinas: la ejecución limpia fija el reparto (1 hilo, 64 tareas por hilo).
+    config.interval_seconds = 3600.0;
+    ParallelCountStats clean = nqueens_count_parallel(10, 1, 64, config);
+    check(clean.solutions == 724 && clean.resumed_tasks == 0, "conteo de 10 reinas sin checkpoint");
+    auto fake_checkpoint = [&](int N) {
+        CheckpointWriter writer(config.path, sizeof(NQueensPrefix), nqueens_count_fingerprint(N, clean.prefix_rows, clean.tasks));
+        long long counters[2] = {7, 0};
+        writer.write(counters);
+        writer.write_vector(std::vector<uint8_t>(clean.tasks, 1));
+        return writer.commit();
+    };
+    check(fake_checkpoint(10), "escribe el checkpoint del conteo");
+    ParallelCountStats resumed_count = nqueens_count_parallel(10, 1, 64, config);
+    check(resumed_count.resumed_tasks == clean.tasks && resumed_count.solutions == 7, "el conteo reanuda con su checkpoint");
+    check(fake_checkpoint(9), "escribe el checkpoint de otra instancia");
+    ParallelCountStats other_count = nqueens_count_parallel(10, 1, 64, config);
+    check(other_count.resumed_tasks == 0 && other_count.solutions == 724, "el conteo rechaza el checkpoint de otro N");
+
+    std::remove(config.path);
+    if (failures == 0) std::printf("OK\n");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,47 @@
+// --- Prueba de la base de patrones de Hanói (ver hanoi_problem.h) ---
+//
+// Uso:
+//   g++ -O2 -std=c++17 hanoi_pdb_test.cpp -o hanoi_pdb_test && ./hanoi_pdb_test
+//
+// Con 3 postes la distancia óptima desde todos los discos en el poste 0 es
+// 2^k - 1. Para k <= PDB_DISKS la heurística es un único bloque y debe dar
+// exactamente ese valor; con k = PDB_DISKS = 8 la entrada vale 255, el valor
+// que antes se usaba como "sin visitar". Devuelve 0 si todo pasa.
+
+#include <cstdio>
+
+#include "../hanoi_problem.h"
+
+static int failures = 0;
+
+static void check(bool ok, const char *what, int k, long long got, long long want) {
+    if (ok) return;
+    failures++;
+    std::printf("FALLO %s (k=%d): %lld, se esperaba %lld\n", what, k, got, want);
+}
+
+int main() {
+    for (int k = 1; k <= HanoiProblem::PDB_DISKS; k++) {
+        HanoiProblem problem(3, k);
+        const long long want = (1LL << k) - 1;
+        check(problem.heuristic(problem.initial()) == want, "h(inicial)", k, problem.heuristic(problem.initial()), want);
+        check(problem.heuristic(problem.goal_state()) == 0, "h(objetivo)", k, problem.heuristic(problem.goal_state()), 0);
+    }
+
+    // Entrada cruda: el estado 0 de la base son los PDB_DISKS discos en el poste 0.
+    HanoiProblem full(3, HanoiProblem::PDB_DISKS);
+    const long long want = (1LL << HanoiProblem::PDB_DISKS) - 1;
+    check(full.pdb[full.initial()] == want, "pdb[inicial]", HanoiProblem::PDB_DISKS, full.pdb[full.initial()], want);
+
+    // Solo el objetivo vale 0: con el centinela 255 las entradas a distancia 255 se
+    // revisitaban y 255 + 1 se desbordaba a 0.
+    int wrapped = 0;
+    for (size_t i = 0; i < full.pdb.size(); i++) {
+        if ((i & (i >> 1) & 0x5555) != 0) continue; // Algún disco en el poste 3 (inexistente)
+        if (full.pdb[i] == 0 && i != (size_t)full.goal_state()) wrapped++;
+    }
+    check(wrapped == 0, "entradas a 0 fuera del objetivo", HanoiProblem::PDB_DISKS, wrapped, 0);
+
+    if (failures == 0) std::printf("OK\n");
+    return failures == 0 ? 0 : 1;
+}
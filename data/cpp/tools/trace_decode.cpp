@@ -0,0 +1,93 @@
+// --- Decodificador de trazas binarias de búsqueda (ver search_trace.h) ---
+//
+// Uso:
+//   g++ -O2 -std=c++17 -pthread trace_decode.cpp -o trace_decode
+//   SEARCH_TRACE_FILE=traza.bin ./Hanoi_N3M8
+//   ./trace_decode traza.bin              -> resumen por tipo, hilo y profundidad
+//   ./trace_decode traza.bin --events 50  -> además, los primeros 50 eventos en texto
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <vector>
+
+#include "../search_trace.h"
+
+using namespace std;
+
+static const char *type_name(uint8_t type) {
+    switch (type) {
+        case TRACE_EXPAND: return "EXPAND";
+        case TRACE_GENERATE: return "GENERATE";
+        case TRACE_PRUNE: return "PRUNE";
+        case TRACE_GOAL: return "GOAL";
+        case TRACE_BACKTRACK: return "BACKTRACK";
+        default: return "?";
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Uso: %s <traza.bin> [--events N]\n", argv[0]);
+        return 1;
+    }
+    long long print_events = 0;
+    for (int i = 2; i + 1 < argc; ++i) {
+        if (strcmp(argv[i], "--events") == 0) print_events = atoll(argv[i + 1]);
+    }
+
+    FILE *f = fopen(argv[1], "rb");
+    if (f == nullptr) {
+        fprintf(stderr, "No se pudo abrir %s\n", argv[1]);
+        return 1;
+    }
+    uint32_t header[3];
+    if (fread(header, sizeof(header), 1, f) != 1 || header[0] != TRACE_MAGIC) {
+        fprintf(stderr, "%s no es una traza de búsqueda\n", argv[1]);
+        return 1;
+    }
+    if (header[1] != TRACE_VERSION || header[2] != sizeof(TraceEvent)) {
+        fprintf(stderr, "Versión de traza no soportada (v%u, %u bytes por evento)\n", header[1], header[2]);
+        return 1;
+    }
+
+    long long total = 0, blocks = 0;
+    long long per_type[8] = {0};
+    map<uint32_t, long long> per_thread;
+    map<int, long long> expands_per_depth;
+    vector<TraceEvent> events(TraceChunk::CAPACITY);
+    uint32_t block_header[2]; // hilo + cantidad
+
+    while (fread(block_header, sizeof(block_header), 1, f) == 1) {
+        uint32_t count = block_header[1];
+        if (count > TraceChunk::CAPACITY || fread(events.data(), sizeof(TraceEvent), count, f) != count) {
+            fprintf(stderr, "Traza truncada en el bloque %lld\n", blocks);
+            break;
+        }
+        blocks++;
+        per_thread[block_header[0]] += count;
+        for (uint32_t i = 0; i < count; ++i) {
+            const TraceEvent &e = events[i];
+            if (total < print_events) {
+                printf("%8lld hilo=%-3u %-9s hash=%016llx prof=%-4u g=%-4d h=%d\n", total, block_header[0],
+                       type_name(e.type), (unsigned long long)e.state_hash, e.depth, e.g, e.h);
+            }
+            total++;
+            per_type[e.type & 7]++;
+            if (e.type == TRACE_EXPAND) expands_per_depth[e.depth]++;
+        }
+    }
+    fclose(f);
+
+    printf("\n--- RESUMEN DE LA TRAZA ---\n");
+    printf("Eventos: %lld en %lld bloques\n", total, blocks);
+    for (int t = TRACE_EXPAND; t <= TRACE_BACKTRACK; ++t) {
+        printf("  %-9s %lld\n", type_name((uint8_t)t), per_type[t]);
+    }
+    printf("Eventos por hilo:\n");
+    for (auto &p : per_thread) printf("  hilo %-3u %lld\n", p.first, p.second);
+    printf("Expansiones por profundidad:\n");
+    for (auto &p : expands_per_depth) printf("  %4d %lld\n", p.first, p.second);
+    return 0;
+}